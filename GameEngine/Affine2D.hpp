@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Transformations2D.hpp"
+#include "TransformKernels.hpp"
+
+#include <stdexcept>
+#include <span>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry::Transformations2D
+{
+    // Affine transformation in the same row-vector convention as Mat2f (v' = v * M):
+    //     | m00 m01 0 |
+    //     | m10 m11 0 |
+    //     | m20 m21 1 |
+    // Last column is always (0, 0, 1), so it is neither stored nor multiplied
+    class Affine2D final
+    {
+    public:
+
+        constexpr Affine2D() noexcept = default;
+        constexpr Affine2D(float m00, float m01, float m10, float m11, float m20, float m21) noexcept
+        :
+        m00{ m00 }, m01{ m01 },
+        m10{ m10 }, m11{ m11 },
+        m20{ m20 }, m21{ m21 }
+        { }
+        constexpr explicit Affine2D(Mat2f const& m) noexcept
+        {
+            auto const m_data{ m.flattern() };
+            assert(("Matrix is not affine transformation", Auxiliry::is_equal_with_precision(m_data[2U], 0.f) && Auxiliry::is_equal_with_precision(m_data[5U], 0.f) && Auxiliry::is_equal_with_precision(m_data[8U], k)));
+
+            m00 = m_data[0U]; m01 = m_data[1U];
+            m10 = m_data[3U]; m11 = m_data[4U];
+            m20 = m_data[6U]; m21 = m_data[7U];
+        }
+
+        constexpr Affine2D(Affine2D const&) noexcept = default;
+        constexpr Affine2D(Affine2D&&)      noexcept = default;
+
+        constexpr Affine2D& operator=(Affine2D const&) noexcept = default;
+        constexpr Affine2D& operator=(Affine2D&&)      noexcept = default;
+
+        constexpr ~Affine2D() noexcept = default;
+
+
+        static constexpr Affine2D get_rotation(radian phi, float r = 1.f) noexcept
+        {
+            float const c{ r * ConstexprMath::cos(phi) };
+            float const s{ r * ConstexprMath::sin(phi) };
+
+            return Affine2D{ c, -s, s, c, 0.f, 0.f };
+        }
+
+        static constexpr Affine2D get_translation(float dx, float dy) noexcept
+        {
+            return Affine2D{ 1.f, 0.f, 0.f, 1.f, dx, dy };
+        }
+
+        static constexpr Affine2D get_scaling(float mx, float my) noexcept
+        {
+            return Affine2D{ mx, 0.f, 0.f, my, 0.f, 0.f };
+        }
+
+
+        constexpr Mat2f to_matrix() const noexcept
+        {
+            return Mat2f
+            {
+                std::array
+                {
+                    m00, m01, 0.f,
+                    m10, m11, 0.f,
+                    m20, m21, k
+                }
+            };
+        }
+
+        // { m00, m01, m10, m11, m20, m21 }
+        constexpr std::array<float, 6U> get_coefficients() const noexcept
+        {
+            return { m00, m01, m10, m11, m20, m21 };
+        }
+
+        constexpr Vec2f apply(Vec2f const& v) const noexcept
+        {
+            return Vec2f{ v.x * m00 + v.y * m10 + m20, v.x * m01 + v.y * m11 + m21 };
+        }
+
+        // Transforms vertices in place, several vertices per vector instruction
+        void apply(std::span<Vec2f> vertices) const noexcept
+        {
+            static_assert(sizeof(Vec2f) == 2U * sizeof(float) && std::is_standard_layout_v<Vec2f>, "Vertices must be interleaved x and y floats");
+
+            auto const m{ get_coefficients() };
+            Kernels::transform_interleaved(m.data(), reinterpret_cast<float*>(vertices.data()), vertices.size());
+        }
+
+        // Transforms vertices stored as separate arrays of coordinates in place
+        void apply(std::span<float> x, std::span<float> y) const noexcept
+        {
+            assert(("Arrays of coordinates must have the same size", x.size() == y.size()));
+
+            auto const m{ get_coefficients() };
+            Kernels::transform_soa(m.data(), x.data(), y.data(), x.size());
+        }
+
+        // Same order as for matrices: lhs is applied first
+        constexpr Affine2D& operator*=(Affine2D const& rhs) noexcept
+        {
+            *this = Affine2D
+            {
+                m00 * rhs.m00 + m01 * rhs.m10,
+                m00 * rhs.m01 + m01 * rhs.m11,
+                m10 * rhs.m00 + m11 * rhs.m10,
+                m10 * rhs.m01 + m11 * rhs.m11,
+                m20 * rhs.m00 + m21 * rhs.m10 + rhs.m20,
+                m20 * rhs.m01 + m21 * rhs.m11 + rhs.m21
+            };
+            return *this;
+        }
+
+        friend constexpr Affine2D operator*(Affine2D lhs, Affine2D const& rhs) noexcept
+        {
+            return lhs *= rhs;
+        }
+
+        constexpr float get_determinant() const noexcept
+        {
+            return m00 * m11 - m01 * m10;
+        }
+
+        constexpr Affine2D get_inversed() const
+        {
+            float const D{ get_determinant() };
+            // Exact zero only, as for Matrix: small scaling has small determinant, but is still well-conditioned
+            if (D == 0.f) throw std::runtime_error{ "Matrix is singular" };
+
+            float const i00{  m11 / D };
+            float const i01{ -m01 / D };
+            float const i10{ -m10 / D };
+            float const i11{  m00 / D };
+
+            return Affine2D
+            {
+                i00, i01,
+                i10, i11,
+                -(m20 * i00 + m21 * i10),
+                -(m20 * i01 + m21 * i11)
+            };
+        }
+
+        friend constexpr bool operator==(Affine2D const& lhs, Affine2D const& rhs) noexcept
+        {
+            return Auxiliry::is_equal_with_precision(lhs.m00, rhs.m00) && Auxiliry::is_equal_with_precision(lhs.m01, rhs.m01) &&
+                   Auxiliry::is_equal_with_precision(lhs.m10, rhs.m10) && Auxiliry::is_equal_with_precision(lhs.m11, rhs.m11) &&
+                   Auxiliry::is_equal_with_precision(lhs.m20, rhs.m20) && Auxiliry::is_equal_with_precision(lhs.m21, rhs.m21);
+        }
+
+        friend constexpr bool operator!=(Affine2D const& lhs, Affine2D const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+
+        float m00{ 1.f }, m01{ 0.f };
+        float m10{ 0.f }, m11{ 1.f };
+        float m20{ 0.f }, m21{ 0.f };
+    };
+
+    inline constexpr void apply(Vec2f& lhs, Affine2D const& rhs) noexcept
+    {
+        lhs = rhs.apply(lhs);
+    }
+
+    constexpr Affine2D get_inversed(Affine2D const& m)
+    {
+        return m.get_inversed();
+    }
+}
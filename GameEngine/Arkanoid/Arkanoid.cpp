@@ -15,6 +15,7 @@ lives         { 0, N_LIVES, { PLAYFIELD_AREA.right, PLAYFIELD_AREA.top }, heart,
 points_counter{ POINTS_LEFT_TOP_POS, C1 }
 { 
     bricks.reserve(N_BRICKS_TOTAL);
+    brick_boxes.reserve(N_BRICKS_TOTAL);
     spawn_bricks();
 }
 
@@ -47,7 +48,6 @@ void Arkanoid::update_in_progress_stage(float dt) noexcept
 
     update_paddle(dt);
     update_ball(dt);
-    update_bricks();
     update_missiles(dt);
     update_blows(dt);
 }
@@ -102,6 +102,7 @@ void Arkanoid::update_gameover_stage() noexcept
             lives.reset();
             points_counter.reset();
             bricks.clear();
+            brick_boxes.clear();
             spawn_bricks();
             cur_stage = GameStage::START;
         }
@@ -134,7 +135,21 @@ void Arkanoid::update_paddle(float dt) noexcept
 
 void Arkanoid::update_ball(float dt) noexcept
 {
-    ball.update(dt);
+    // Long frame is split into steps not longer than radius of the ball, so it can't tunnel through walls or paddle
+    std::size_t const n_steps{ ball.get_n_substeps(dt) };
+    float const step_dt{ dt / static_cast<float>(n_steps) };
+
+    for (std::size_t i{ 0U }; i != n_steps && cur_stage == GameStage::IN_PROGRESS; ++i)
+    {
+        update_ball_step(step_dt);
+    }
+}
+
+void Arkanoid::update_ball_step(float dt) noexcept
+{
+    move_ball_through_bricks(dt);
+    if (cur_stage != GameStage::IN_PROGRESS) return;
+
     if (!field.is_in_field(ball))
     {
         if (field.is_in_lose_zone(ball))
@@ -153,23 +168,67 @@ void Arkanoid::update_ball(float dt) noexcept
     }
 }
 
-void Arkanoid::update_bricks() noexcept
+void Arkanoid::move_ball_through_bricks(float dt) noexcept
 {
-    if (auto const collided_brick{ std::ranges::find_if(bricks, [&ball = this->ball](auto const& brick) { return brick.is_collided_with(ball); })}; collided_brick != bricks.end())
-    {
-        collided_brick->deflect(ball);
+    Vec2f const displacement{ ball.get_displacement(dt) };
+    Rec2i const box{ ball.get_collision_box() };
 
-        missiles.emplace_back(Vec2i{ ball.get_collision_box().get_center().x, PLAYFIELD_AREA.top }, MISSILE_SPEED, rocket, GameEngine::Colours::MAGENTA);
-        if (bricks.erase(collided_brick); bricks.empty())
+    // Only bricks touched by the box swept along the step may be hit, they are found by one batched query
+    Vec2i const end_offset{ displacement };
+    Rec2i const swept_box
+    {
+        Rec2i
         {
-            cur_stage = GameStage::GAMEOVER;
+            std::min(box.left, box.left + end_offset.x),  std::max(box.right, box.right + end_offset.x),
+            std::max(box.bottom, box.bottom + end_offset.y), std::min(box.top, box.top + end_offset.y)
+        }.get_expanded(1)
+    };
 
-            return;
+    std::optional<GameEngine::Geometry::Contact> earliest{ };
+    std::size_t hit_brick{ brick_boxes.get_size() };
+
+    auto const candidates{ brick_boxes.get_collisions(swept_box) };
+    for (std::size_t word{ 0U }; word != candidates.size(); ++word)
+    {
+        for (std::uint64_t bits{ candidates[word] }; bits != 0U; bits &= bits - 1U)
+        {
+            std::size_t const i{ word * 64U + static_cast<std::size_t>(std::countr_zero(bits)) };
+            if (auto const contact{ GameEngine::Geometry::get_swept_contact(box, displacement, brick_boxes.get_element(i)) }; contact.has_value() && (!earliest.has_value() || contact->time < earliest->time))
+            {
+                earliest = contact;
+                hit_brick = i;
+            }
         }
+    }
 
-        pad.reset_cooldown();
-        points_counter.brick_destroyed(lives.get_cur_n_lives());
+    if (!earliest.has_value())
+    {
+        ball.update(dt);
+
+        return;
     }
+
+    // Ball stops at the earliest contact of the step, the rest of the step is dropped
+    ball.update(dt * earliest->time);
+    if (earliest->time == 0.f && ball.is_collided_with(bricks[hit_brick])) bricks[hit_brick].deflect(ball);
+    else                                                                     ball.reflect(earliest->normal);
+
+    destroy_brick(hit_brick);
+}
+
+void Arkanoid::destroy_brick(std::size_t i) noexcept
+{
+    missiles.emplace_back(Vec2i{ ball.get_collision_box().get_center().x, PLAYFIELD_AREA.top }, MISSILE_SPEED, rocket, GameEngine::Colours::MAGENTA);
+    brick_boxes.erase(i);
+    if (bricks.erase(bricks.begin() + static_cast<std::ptrdiff_t>(i)); bricks.empty())
+    {
+        cur_stage = GameStage::GAMEOVER;
+
+        return;
+    }
+
+    pad.reset_cooldown();
+    points_counter.brick_destroyed(lives.get_cur_n_lives());
 }
 
 void Arkanoid::update_missiles(float dt) noexcept
@@ -177,20 +236,32 @@ void Arkanoid::update_missiles(float dt) noexcept
     for (auto missile{ missiles.begin() }; missile != missiles.end(); ++missile)
     {
         if (missile->is_destroyed()) continue;
-        missile->update(dt);
 
-        if (missile->is_collided_with(pad))
-        {
-            decrease_lives();
+        std::size_t const n_steps{ missile->get_n_substeps(dt) };
+        float const step_dt{ dt / static_cast<float>(n_steps) };
 
-            return;
-        }
-        if (missile->is_collided_with(ball) || field.get_collision_box().bottom < missile->get_collision_box().bottom)
+        for (std::size_t i{ 0U }; i != n_steps && !missile->is_destroyed(); ++i)
         {
-            missile->destroy();
-            pad.reset_cooldown();
-
-            cascade_blows(blows.emplace_back(missile->get_pos(), GameEngine::Animation{ blow_effect, BLOW_DURATION }, GameEngine::Colours::MAGENTA));
+            // The earliest contact within the step decides whether missile hits the paddle or the ball
+            Vec2f const displacement{ missile->get_displacement(step_dt) };
+            auto const pad_contact { missile->get_swept_contact(displacement, pad) };
+            auto const ball_contact{ missile->get_swept_contact(displacement, ball) };
+
+            if (pad_contact.has_value() && (!ball_contact.has_value() || pad_contact->time <= ball_contact->time))
+            {
+                decrease_lives();
+
+                return;
+            }
+
+            missile->update(step_dt * (ball_contact.has_value() ? ball_contact->time : 1.f));
+            if (ball_contact.has_value() || field.get_collision_box().bottom < missile->get_collision_box().bottom)
+            {
+                missile->destroy();
+                pad.reset_cooldown();
+
+                cascade_blows(blows.emplace_back(missile->get_pos(), GameEngine::Animation{ blow_effect, BLOW_DURATION }, GameEngine::Colours::MAGENTA));
+            }
         }
     }
     std::erase_if(missiles, [](Missile const& missile)
@@ -265,6 +336,7 @@ void Arkanoid::spawn_bricks() noexcept
     for (int i{ 0 }; i != N_BRICKS_TOTAL; ++i)
     {
         bricks.emplace_back(GRID_BRICKS_BEG + brick_size * Vec2i{ i % N_BRICKS_IN_ROW, i / N_BRICKS_IN_ROW }, ROW_COLOURS[static_cast<std::array<GameEngine::Colour, 5>::size_type>(i / N_BRICKS_IN_ROW)]);
+        brick_boxes.push_back(bricks.back().get_collision_box());
     }
 }
 
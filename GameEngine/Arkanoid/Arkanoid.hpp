@@ -6,6 +6,7 @@
 #include <FrameTimer.hpp>
 #include <Animation.hpp>
 #include <Mouse.hpp>
+#include <RectangleBatch.hpp>
 
 #include "Paddle.hpp"
 #include "PlayField.hpp"
@@ -15,6 +16,10 @@
 #include "LifeCounter.hpp"
 #include "Score.hpp"
 
+#include <bit>
+#include <cstdint>
+#include <optional>
+
 
 class Arkanoid final : public GameEngine::Game
 {
@@ -58,7 +63,9 @@ private:
 
     void update_paddle(float dt) noexcept;
     void update_ball(float dt) noexcept;
-    void update_bricks() noexcept;
+    void update_ball_step(float dt) noexcept;
+    void move_ball_through_bricks(float dt) noexcept;
+    void destroy_brick(std::size_t i) noexcept;
     void update_missiles(float dt) noexcept;
     void update_blows(float dt) noexcept;
 
@@ -140,6 +147,7 @@ private:
     Paddle    pad;
     GameEngine::FrameTimer ft{ };
     std::vector<Brick>     bricks;
+    GameEngine::Geometry::RectangleBatch<int> brick_boxes;
     Ball      ball;
 
     GameEngine::Surface   gamestart_img;
@@ -14,7 +14,7 @@ cur_speed{ init_speed }
 
 void Ball::draw(GameEngine::Interfaces::IGraphics2D& gfx, std::optional<GameEngine::Geometry::Rectangle2D<int>> const&) const
 {
-    gfx.fill_ellipse(cur_pos, RADIUS, RADIUS, c);
+    gfx.fill_ellipse(get_pixel_pos(), RADIUS, RADIUS, c);
 }
 
 void Ball::update(float dt) noexcept
@@ -38,7 +38,7 @@ void Ball::reset() noexcept
 
 Ball::Rec2i Ball::get_collision_box() const noexcept
 {
-    return Rec2i::get_from_center(cur_pos, RADIUS, RADIUS);
+    return Rec2i::get_from_center(get_pixel_pos(), RADIUS, RADIUS);
 }
 
 Ball::Vec2f Ball::get_direction() const noexcept
@@ -46,6 +46,16 @@ Ball::Vec2f Ball::get_direction() const noexcept
     return cur_vel;
 }
 
+Ball::Vec2f Ball::get_displacement(float dt) const noexcept
+{
+    return cur_vel * dt;
+}
+
+std::size_t Ball::get_n_substeps(float dt) const noexcept
+{
+    return GameEngine::Geometry::get_n_substeps(cur_vel, dt, MAX_STEP_LENGTH);
+}
+
 void Ball::change_direction(GameEngine::Geometry::Vector2D<float> const& dir) noexcept
 {
     cur_vel = dir.get_normalized() * cur_speed;
@@ -55,7 +65,7 @@ void Ball::change_direction(GameEngine::Geometry::Vector2D<float> const& dir) no
 
 void Ball::move_by(Vec2i const& dpos) noexcept
 {
-    cur_pos += dpos;
+    cur_pos += Vec2f{ dpos };
 }
 
 void Ball::move_to(Vec2i const& pos) noexcept
@@ -72,3 +82,17 @@ void Ball::inverse_y() noexcept
 {
     cur_vel.y *= -1.f;
 }
+
+void Ball::reflect(Vec2f const& normal) noexcept
+{
+    // Only velocity towards the surface is reflected, so the ball isn't turned back into it
+    if (float const projection{ cur_vel.x * normal.x + cur_vel.y * normal.y }; projection < 0.f)
+    {
+        cur_vel -= normal * (2.f * projection);
+    }
+}
+
+Ball::Vec2i Ball::get_pixel_pos() const noexcept
+{
+    return Vec2i{ static_cast<int>(std::lround(cur_pos.x)), static_cast<int>(std::lround(cur_pos.y)) };
+}
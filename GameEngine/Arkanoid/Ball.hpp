@@ -6,6 +6,8 @@
 #include <IDrawable.hpp>
 #include <Collidable.hpp>
 
+#include <cstddef>
+
 
 class Ball final : public GameEngine::Abstract::Collidable, public GameEngine::Interfaces::IDrawable
 {
@@ -40,6 +42,8 @@ public:
     Rec2i get_collision_box() const noexcept override;
     
     Vec2f get_direction() const noexcept;
+    Vec2f get_displacement(float dt) const noexcept;
+    std::size_t get_n_substeps(float dt) const noexcept;
     void change_direction(GameEngine::Geometry::Vector2D<float> const& dir) noexcept;
 
     void move_by(Vec2i const& dpos) noexcept;
@@ -47,19 +51,28 @@ public:
 
     void inverse_x() noexcept;
     void inverse_y() noexcept;
+    void reflect(Vec2f const& normal) noexcept;
+
+private:
+
+    Vec2i get_pixel_pos() const noexcept;
 
 private:
 
     static constexpr float MIN_ABS_X_VEL{ 60.f };
     static constexpr float MIN_ABS_Y_VEL{ 60.f };
 
+    // Ball can't pass through a wall, the paddle or a brick if it moves not farther than its radius between checks
+    static constexpr float MAX_STEP_LENGTH{ static_cast<float>(RADIUS) };
+
     static constexpr GameEngine::Colour c{ GameEngine::Colours::LIGHT_GOLDEN_ROD_YELLOW };
 
     Vec2i const init_pos;
     float const init_speed;
     Vec2f const init_dir;
 
-    Vec2i cur_pos;
+    // Position is kept in float, so small steps aren't truncated to whole pixels
+    Vec2f cur_pos;
     float cur_speed;
     Vec2f cur_vel;
 };
\ No newline at end of file
@@ -14,7 +14,8 @@ void Missile::draw(GameEngine::Interfaces::IGraphics2D& gfx, std::optional<GameE
     assert(!is_destroyed());
     assert(clipping_area.has_value());
 
-    gfx.draw_sprite_excluding_color(Vec2i{ cur_pos.x - static_cast<int>(sprite.first.get_width() / 2U), cur_pos.y - static_cast<int>(sprite.first.get_height() / 2U) }, sprite.first, sprite.second, *clipping_area);
+    Vec2i const pos{ get_pos() };
+    gfx.draw_sprite_excluding_color(Vec2i{ pos.x - static_cast<int>(sprite.first.get_width() / 2U), pos.y - static_cast<int>(sprite.first.get_height() / 2U) }, sprite.first, sprite.second, *clipping_area);
 }
 
 void Missile::update(float dt) noexcept
@@ -26,12 +27,22 @@ void Missile::update(float dt) noexcept
 
 Missile::Rec2i Missile::get_collision_box() const noexcept
 {
-    return Rec2i::get_from_center(cur_pos, COLLISION_HALF_WIDTH, COLLISION_HALF_HEIGHT);
+    return Rec2i::get_from_center(get_pos(), COLLISION_HALF_WIDTH, COLLISION_HALF_HEIGHT);
 }
 
 Missile::Vec2i Missile::get_pos() const noexcept
 {
-    return cur_pos;
+    return Vec2i{ static_cast<int>(std::lround(cur_pos.x)), static_cast<int>(std::lround(cur_pos.y)) };
+}
+
+Missile::Vec2f Missile::get_displacement(float dt) const noexcept
+{
+    return cur_vel * dt;
+}
+
+std::size_t Missile::get_n_substeps(float dt) const noexcept
+{
+    return GameEngine::Geometry::get_n_substeps(cur_vel, dt, MAX_STEP_LENGTH);
 }
 
 void Missile::destroy() noexcept
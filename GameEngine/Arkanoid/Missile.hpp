@@ -8,6 +8,8 @@
 
 #include "PlayField.hpp"
 
+#include <cstddef>
+
 
 class Missile final : public GameEngine::Abstract::Collidable, public GameEngine::Interfaces::IDrawable
 {
@@ -61,6 +63,8 @@ public:
 
     Rec2i get_collision_box() const noexcept override;
     Vec2i get_pos() const noexcept;
+    Vec2f get_displacement(float dt) const noexcept;
+    std::size_t get_n_substeps(float dt) const noexcept;
 
     void destroy() noexcept;
     bool is_destroyed() const noexcept;
@@ -69,9 +73,12 @@ private:
 
     static constexpr Vec2f DIR{ 0.f, 1.f };
 
+    // Half of the collision box, so the paddle and the ball, which also move during the frame, are tested often enough
+    static constexpr float MAX_STEP_LENGTH{ static_cast<float>(COLLISION_HALF_HEIGHT) };
+
     bool  destroyed{ false };
 
-    Vec2i cur_pos;
+    Vec2f cur_pos;
 
     float cur_speed;
     Vec2f cur_vel;
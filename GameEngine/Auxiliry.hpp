@@ -2,10 +2,28 @@
 
 #include <numbers>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <concepts>
+#include <type_traits>
+#include <utility>
 
 
 namespace GameEngine::Geometry
 {
+    // Type that can be element of matrix or coordinate of vector: built-in numbers, fixed-point numbers, etc.
+    template<typename T>
+    concept arithmetic_like = requires (T)
+    {
+        std::declval<T const&>() + std::declval<T const&>();
+        std::declval<T const&>() - std::declval<T const&>();
+        std::declval<T const&>() * std::declval<T const&>();
+        std::declval<T const&>() / std::declval<T const&>();
+        std::declval<T&>() = std::declval<T const&>();
+        std::declval<T const&>() == std::declval<T const&>();
+        std::declval<T const&>() != std::declval<T const&>();
+    } && std::is_default_constructible_v<T> == true;
+
     namespace Literals
     {
         inline constexpr double operator ""_deg(long double angle) noexcept
@@ -31,5 +49,43 @@ namespace GameEngine::Geometry
         {
             return val < static_cast<T>(0);
         }
+
+        template<std::signed_integral T>
+        [[maybe_unused]] [[nodiscard("Pure function")]] constexpr inline T get_checked_product(T a, T b)
+        {
+            constexpr T MAX{ std::numeric_limits<T>::max() };
+            constexpr T MIN{ std::numeric_limits<T>::min() };
+            constexpr T ZERO{ 0 };
+
+            bool const overflow
+            {
+                a > ZERO ? (b > ZERO ? a > MAX / b : b < MIN / a) :
+                a < ZERO ? (b > ZERO ? a < MIN / b : b < ZERO && a < MAX / b) :
+                false
+            };
+            if (overflow) throw std::overflow_error{ "Integer multiplication overflow" };
+
+            return static_cast<T>(a * b);
+        }
+
+        template<std::signed_integral T>
+        [[maybe_unused]] [[nodiscard("Pure function")]] constexpr inline T get_checked_difference(T a, T b)
+        {
+            constexpr T MAX{ std::numeric_limits<T>::max() };
+            constexpr T MIN{ std::numeric_limits<T>::min() };
+            constexpr T ZERO{ 0 };
+
+            if ((b < ZERO && a > MAX + b) || (b > ZERO && a < MIN + b)) throw std::overflow_error{ "Integer subtraction overflow" };
+
+            return static_cast<T>(a - b);
+        }
+
+        template<std::signed_integral T>
+        [[maybe_unused]] [[nodiscard("Pure function")]] constexpr inline T get_checked_quotient(T a, T b)
+        {
+            if (a == std::numeric_limits<T>::min() && b == static_cast<T>(-1)) throw std::overflow_error{ "Integer division overflow" };
+
+            return static_cast<T>(a / b);
+        }
     }
 }
\ No newline at end of file
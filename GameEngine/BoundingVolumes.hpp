@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Rectangle2D.hpp"
+#include "VectorKernels.hpp"
+
+#include <span>
+#include <cmath>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry
+{
+    // Simple volumes around a set of points, so tests of far objects don't walk all of their vertices.
+    // Boxes have top < bottom as for Rectangle2D::is_colided_with and OrientedBox2D::get_bounding_box.
+
+    struct BoundingCircle final
+    {
+        bool contains(Vector2D<float> const& point) const noexcept
+        {
+            return (point - center).get_square_length() <= radius * radius;
+        }
+        bool is_intersected_with(BoundingCircle const& circle) const noexcept
+        {
+            float const r{ radius + circle.radius };
+            return (circle.center - center).get_square_length() < r * r;
+        }
+
+
+        Vector2D<float> center{ 0.f, 0.f };
+        float radius{ 0.f };
+    };
+
+    // Min and max of both coordinates in one pass of vector instructions. points must not be empty
+    inline Rectangle2D<float> get_bounding_box(std::span<Vector2D<float> const> points) noexcept
+    {
+        static_assert(sizeof(Vector2D<float>) == 2U * sizeof(float) && std::is_standard_layout_v<Vector2D<float>>, "Points must be interleaved x and y floats");
+        assert(("Bounding box of no points is undefined", !points.empty()));
+
+        float min_xy[2U];
+        float max_xy[2U];
+        VectorKernels::get_bounds(reinterpret_cast<float const*>(points.data()), points.size(), min_xy, max_xy);
+        return Rectangle2D<float>{ min_xy[0U], max_xy[0U], max_xy[1U], min_xy[1U] };
+    }
+
+    // Circle around center of bounding box: up to sqrt(2) times larger than the smallest one, but needs no iterations.
+    // Radius is the distance to the farthest point, so the hull of points gives the same circle as all of them
+    inline BoundingCircle get_bounding_circle(std::span<Vector2D<float> const> points, Rectangle2D<float> const& bounding_box) noexcept
+    {
+        BoundingCircle res{ bounding_box.get_center(), 0.f };
+
+        float max_square_distance{ 0.f };
+        for (auto const& point : points)
+        {
+            max_square_distance = std::max(max_square_distance, (point - res.center).get_square_length());
+        }
+        res.radius = std::sqrt(max_square_distance);
+        return res;
+    }
+
+    // Andrew's monotone chain: points sorted by x (then y) are swept once for the lower chain and once for the upper one.
+    // Hull goes counterclockwise for the normal direction of y axis (clockwise on screen), collinear points are dropped
+    inline std::vector<Vector2D<float>> get_convex_hull(std::span<Vector2D<float> const> points)
+    {
+        std::vector<Vector2D<float>> sorted(points.begin(), points.end());
+        std::ranges::sort(sorted, [](Vector2D<float> const& lhs, Vector2D<float> const& rhs) { return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.y < rhs.y); });
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        if (sorted.size() < 3U) return sorted;
+
+        // Positive if o -> a -> b turns counterclockwise
+        auto const get_cross{ [](Vector2D<float> const& o, Vector2D<float> const& a, Vector2D<float> const& b) noexcept
+        {
+            return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+        } };
+
+        std::vector<Vector2D<float>> res(sorted.size() * 2U);
+        std::size_t n{ 0U };
+        for (std::size_t i{ 0U }; i != sorted.size(); ++i)
+        {
+            while (n >= 2U && !(get_cross(res[n - 2U], res[n - 1U], sorted[i]) > 0.f)) --n;
+            res[n++] = sorted[i];
+        }
+        // Upper chain can't pop below the last point of the lower one
+        std::size_t const lower_size{ n + 1U };
+        for (std::size_t i{ sorted.size() - 1U }; i-- != 0U;)
+        {
+            while (n >= lower_size && !(get_cross(res[n - 2U], res[n - 1U], sorted[i]) > 0.f)) --n;
+            res[n++] = sorted[i];
+        }
+        // The first point is repeated at the end
+        res.resize(n - 1U);
+        return res;
+    }
+}
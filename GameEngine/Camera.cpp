@@ -6,7 +6,7 @@ namespace GameEngine
     Camera::Camera(Rec2f const& init_camera_area, WorldTransformer& wt, float init_min_zoom, float init_max_zoom) noexcept
     :
     camera_area
-    { 
+    {
         Rec2f::get_from_center_with_normal_y_axis
         (
             init_camera_area.get_center(), 
@@ -17,7 +17,9 @@ namespace GameEngine
     wt{ wt },
     min_zoom{ init_min_zoom },
     max_zoom{ init_max_zoom }
-    { }
+    {
+        update_view();
+    }
 
     void Camera::move(Vec2f delta_pos) noexcept
     {
@@ -25,12 +27,10 @@ namespace GameEngine
 
         auto const compensated_translation
         {
-            Geometry::Transformations2D::to_vector_form
-            (
-                Geometry::Transformations2D::to_matrix_form(delta_pos) * Geometry::Transformations2D::get_rotation(-accumulated_rotation)
-            )
+            Geometry::Transformations2D::Rotation::get_from_angle(-accumulated_rotation).apply(delta_pos)
         };
         accumulated_translation += compensated_translation;
+        update_view();
     }
 
     float Camera::get_zoom() const noexcept
@@ -45,23 +45,27 @@ namespace GameEngine
 
         wt.scale(new_zoom_factor / accumulated_scaling);
         accumulated_scaling = new_zoom_factor;
+        update_view();
     }
 
     void Camera::rotate(radian angle) noexcept
     {
         wt.rotate(angle);
         accumulated_rotation += angle;
+        update_view();
     }
     
-    bool Camera::contains(GameEngine::Shape const& object) const noexcept
+    bool Camera::contains(GameEngine::Shape const& object) const
     {
-        for (auto vertex : object.get_vertices())
-        {
-            vertex -= accumulated_translation;
-            vertex *= accumulated_scaling;
-            vertex.rotate(-accumulated_rotation);
-            if (camera_area.contains_with_normal_y_axis(vertex)) return true;
-        }
-        return false;
+        return object.is_intersected_with(view);
+    }
+
+    void Camera::update_view() noexcept
+    {
+        // World point v is seen at R(-rotation) * ((v - translation) * scaling), so the view is camera area mapped back
+        float const k{ 1.f / accumulated_scaling };
+        Vec2f const center{ accumulated_translation + camera_area.get_center().get_rotated(accumulated_rotation) * k };
+
+        view = Geometry::OrientedBox2D::get_from_center(center, camera_area.get_width() / 2.f * k, camera_area.get_height() / 2.f * k, accumulated_rotation);
     }
 }
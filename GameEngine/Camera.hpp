@@ -26,13 +26,24 @@ namespace GameEngine
 
         void rotate(radian angle) noexcept;
 
-        bool contains(GameEngine::Shape const& object) const noexcept;
+        // Shape is visible if it intersects the view, see Shape::is_intersected_with
+        bool contains(GameEngine::Shape const& object) const;
+
+        // Camera area in world coordinates, so shapes are tested without transforming their vertices
+        Geometry::OrientedBox2D get_view() const noexcept
+        {
+            return view;
+        }
 
         Rec2f get_area() const noexcept
         {
             return camera_area;
         }
 
+    private:
+
+        void update_view() noexcept;
+
     private:
 
         Vec2f accumulated_translation{ 0.f, 0.f };
@@ -44,5 +55,7 @@ namespace GameEngine
 
         float const min_zoom;
         float const max_zoom;
+
+        Geometry::OrientedBox2D view{ };
     };
 }
\ No newline at end of file
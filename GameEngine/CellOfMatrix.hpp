@@ -57,7 +57,7 @@ namespace GameEngine::Geometry::Matrices
             row = new_row;
         }
 
-        constexpr void move_pointer(std::ptrdiff_t delta)
+        constexpr void move_pointer(std::ptrdiff_t delta) noexcept
         {
             data += delta;
         }
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "Rectangle2D.hpp"
+
+#include <span>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry::Clipping
+{
+    // Clipping of segments, polylines and polygons by Rectangle2D before they are given to backend.
+    // Area is inclusive as in Rectangle2D::contains and may have either direction of y axis.
+    // Integer coordinates are intersected in double and rounded, endpoints inside of area are returned unchanged.
+
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    struct Segment2D final
+    {
+        Vector2D<T> beg;
+        Vector2D<T> end;
+    };
+
+    namespace Detail
+    {
+        template<typename T>
+        using Real = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+        template<typename T>
+        struct Bounds final
+        {
+            T x_min;
+            T x_max;
+            T y_min;
+            T y_max;
+        };
+
+        template<typename T>
+        constexpr Bounds<T> get_bounds(Rectangle2D<T> const& area) noexcept
+        {
+            return Bounds<T>
+            {
+                (area.left < area.right) ? area.left : area.right,
+                (area.left < area.right) ? area.right : area.left,
+                (area.bottom < area.top) ? area.bottom : area.top,
+                (area.bottom < area.top) ? area.top : area.bottom
+            };
+        }
+
+        template<typename T>
+        constexpr T from_real(Real<T> const& value) noexcept
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                return static_cast<T>(std::lround(value));
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+        // Cohen-Sutherland outcodes: segment with both codes zero is inside, with common bit is outside
+        enum Outcode : std::uint8_t
+        {
+            INSIDE = 0U,
+            X_MIN  = 1U,
+            X_MAX  = 2U,
+            Y_MIN  = 4U,
+            Y_MAX  = 8U
+        };
+
+        template<typename T>
+        constexpr std::uint8_t get_outcode(Vector2D<T> const& point, Bounds<T> const& bounds) noexcept
+        {
+            return static_cast<std::uint8_t>
+            (
+                (point.x < bounds.x_min ? X_MIN : INSIDE) | (point.x > bounds.x_max ? X_MAX : INSIDE) |
+                (point.y < bounds.y_min ? Y_MIN : INSIDE) | (point.y > bounds.y_max ? Y_MAX : INSIDE)
+            );
+        }
+
+        // Parameters of visible part of beg + t * (end - beg), 0 <= t0 <= t1 <= 1
+        template<typename T>
+        struct Interval final
+        {
+            Real<T> t0;
+            Real<T> t1;
+        };
+
+        // Liang-Barsky: each side cuts interval of t from one end, segment is rejected as soon as interval is empty
+        template<typename T>
+        constexpr std::optional<Interval<T>> get_visible_interval(Vector2D<T> const& beg, Vector2D<T> const& end, Bounds<T> const& bounds) noexcept
+        {
+            Real<T> const x{ static_cast<Real<T>>(beg.x) };
+            Real<T> const y{ static_cast<Real<T>>(beg.y) };
+            Real<T> const dx{ static_cast<Real<T>>(end.x) - x };
+            Real<T> const dy{ static_cast<Real<T>>(end.y) - y };
+
+            Interval<T> res{ Real<T>{ 0 }, Real<T>{ 1 } };
+
+            auto const cut{ [&res](Real<T> const& p, Real<T> const& q) noexcept
+            {
+                if (p == Real<T>{ 0 }) return q >= Real<T>{ 0 };
+
+                Real<T> const t{ q / p };
+                if (p < Real<T>{ 0 })
+                {
+                    if (t > res.t1) return false;
+                    if (t > res.t0) res.t0 = t;
+                }
+                else
+                {
+                    if (t < res.t0) return false;
+                    if (t < res.t1) res.t1 = t;
+                }
+                return true;
+            } };
+
+            if (cut(-dx, x - static_cast<Real<T>>(bounds.x_min)) &&
+                cut( dx, static_cast<Real<T>>(bounds.x_max) - x) &&
+                cut(-dy, y - static_cast<Real<T>>(bounds.y_min)) &&
+                cut( dy, static_cast<Real<T>>(bounds.y_max) - y))
+            {
+                return res;
+            }
+            return std::nullopt;
+        }
+
+        template<typename T>
+        constexpr Vector2D<T> get_point(Vector2D<T> const& beg, Vector2D<T> const& end, Real<T> const& t) noexcept
+        {
+            Real<T> const x{ static_cast<Real<T>>(beg.x) };
+            Real<T> const y{ static_cast<Real<T>>(beg.y) };
+            return Vector2D<T>
+            {
+                from_real<T>(x + (static_cast<Real<T>>(end.x) - x) * t),
+                from_real<T>(y + (static_cast<Real<T>>(end.y) - y) * t)
+            };
+        }
+
+        template<typename T>
+        constexpr Segment2D<T> get_segment(Vector2D<T> const& beg, Vector2D<T> const& end, Interval<T> const& interval) noexcept
+        {
+            return Segment2D<T>
+            {
+                interval.t0 == Real<T>{ 0 } ? beg : get_point(beg, end, interval.t0),
+                interval.t1 == Real<T>{ 1 } ? end : get_point(beg, end, interval.t1)
+            };
+        }
+
+        // One pass of Sutherland-Hodgman: keeps vertices on the inner side of line x = bound (or y = bound)
+        // and inserts intersection point whenever an edge crosses it
+        template<bool IS_X, bool IS_MIN, typename T>
+        void clip_by_side(std::vector<Vector2D<T>> const& polygon, T const& bound, std::vector<Vector2D<T>>& res)
+        {
+            res.clear();
+            if (polygon.empty()) return;
+
+            auto const get_coordinate{ [](Vector2D<T> const& point) noexcept -> T const& { if constexpr (IS_X) return point.x; else return point.y; } };
+            auto const is_inside{ [&get_coordinate, &bound](Vector2D<T> const& point) noexcept { return IS_MIN ? !(get_coordinate(point) < bound) : !(bound < get_coordinate(point)); } };
+            auto const get_intersection{ [&get_coordinate, &bound](Vector2D<T> const& from, Vector2D<T> const& to) noexcept
+            {
+                Real<T> const from_c{ static_cast<Real<T>>(get_coordinate(from)) };
+                Real<T> const t{ (static_cast<Real<T>>(bound) - from_c) / (static_cast<Real<T>>(get_coordinate(to)) - from_c) };
+
+                Vector2D<T> point{ get_point(from, to, t) };
+                if constexpr (IS_X) point.x = bound; else point.y = bound;
+                return point;
+            } };
+
+            Vector2D<T> const* prev{ &polygon.back() };
+            bool is_prev_inside{ is_inside(*prev) };
+            for (auto const& cur : polygon)
+            {
+                bool const is_cur_inside{ is_inside(cur) };
+                if (is_cur_inside != is_prev_inside)
+                {
+                    // Intersection is computed from the outer vertex, so the same edge gives the same point in both directions
+                    res.push_back(is_cur_inside ? get_intersection(*prev, cur) : get_intersection(cur, *prev));
+                }
+                if (is_cur_inside)
+                {
+                    res.push_back(cur);
+                }
+                prev = &cur;
+                is_prev_inside = is_cur_inside;
+            }
+        }
+    }
+
+    // Visible part of segment or nothing if it is outside of area
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    constexpr std::optional<Segment2D<T>> clip_segment(Vector2D<T> const& beg, Vector2D<T> const& end, Rectangle2D<T> const& area) noexcept
+    {
+        Detail::Bounds<T> const bounds{ Detail::get_bounds(area) };
+
+        std::uint8_t const beg_code{ Detail::get_outcode(beg, bounds) };
+        std::uint8_t const end_code{ Detail::get_outcode(end, bounds) };
+        if ((beg_code | end_code) == Detail::INSIDE) return Segment2D<T>{ beg, end };
+        if ((beg_code & end_code) != Detail::INSIDE) return std::nullopt;
+
+        if (auto const interval{ Detail::get_visible_interval(beg, end, bounds) }; interval.has_value())
+        {
+            return Detail::get_segment(beg, end, *interval);
+        }
+        return std::nullopt;
+    }
+
+    // Sutherland-Hodgman clipping of closed polygon (last vertex is connected to the first one) by four sides of area.
+    // Result is exact for convex polygons. Concave polygon may get degenerate edges along sides of area,
+    // which is fine for filling. Result has less than 3 vertices only if it is empty
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    std::vector<Vector2D<T>> clip_polygon(std::span<Vector2D<T> const> polygon, Rectangle2D<T> const& area)
+    {
+        Detail::Bounds<T> const bounds{ Detail::get_bounds(area) };
+
+        std::uint8_t all_codes{ Detail::INSIDE };
+        std::uint8_t common_code{ Detail::X_MIN | Detail::X_MAX | Detail::Y_MIN | Detail::Y_MAX };
+        for (auto const& point : polygon)
+        {
+            std::uint8_t const code{ Detail::get_outcode(point, bounds) };
+            all_codes |= code;
+            common_code &= code;
+        }
+        if (polygon.size() < 3U || common_code != Detail::INSIDE) return std::vector<Vector2D<T>>{ };
+        if (all_codes == Detail::INSIDE) return std::vector<Vector2D<T>>(polygon.begin(), polygon.end());
+
+        // Only sides crossed by some vertex are passed, results ping-pong between two buffers
+        std::vector<Vector2D<T>> res(polygon.begin(), polygon.end());
+        std::vector<Vector2D<T>> buffer{ };
+        buffer.reserve(polygon.size() + 4U);
+
+        auto const pass{ [&res, &buffer](auto clip_side)
+        {
+            clip_side(res, buffer);
+            std::swap(res, buffer);
+        } };
+
+        if (all_codes & Detail::X_MIN) pass([&bounds](auto const& in, auto& out) { Detail::clip_by_side<true,  true >(in, bounds.x_min, out); });
+        if (all_codes & Detail::X_MAX) pass([&bounds](auto const& in, auto& out) { Detail::clip_by_side<true,  false>(in, bounds.x_max, out); });
+        if (all_codes & Detail::Y_MIN) pass([&bounds](auto const& in, auto& out) { Detail::clip_by_side<false, true >(in, bounds.y_min, out); });
+        if (all_codes & Detail::Y_MAX) pass([&bounds](auto const& in, auto& out) { Detail::clip_by_side<false, false>(in, bounds.y_max, out); });
+
+        if (res.size() < 3U) res.clear();
+        return res;
+    }
+
+    // Visible parts of polyline as connected runs of points, every run has at least 2 points.
+    // Outcodes of all points are computed once, so segments inside or outside of area are not intersected at all
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    std::vector<std::vector<Vector2D<T>>> clip_polyline(std::span<Vector2D<T> const> polyline, Rectangle2D<T> const& area)
+    {
+        std::vector<std::vector<Vector2D<T>>> res{ };
+        if (polyline.size() < 2U) return res;
+
+        Detail::Bounds<T> const bounds{ Detail::get_bounds(area) };
+
+        std::vector<std::uint8_t> codes(polyline.size());
+        for (std::size_t i{ 0U }; i != polyline.size(); ++i)
+        {
+            codes[i] = Detail::get_outcode(polyline[i], bounds);
+        }
+
+        // Run is continued only through a vertex that is inside of area
+        bool is_run_open{ false };
+        for (std::size_t i{ 0U }; i + 1U != polyline.size(); ++i)
+        {
+            Vector2D<T> const& beg{ polyline[i] };
+            Vector2D<T> const& end{ polyline[i + 1U] };
+
+            if ((codes[i] & codes[i + 1U]) != Detail::INSIDE)
+            {
+                is_run_open = false;
+                continue;
+            }
+
+            Segment2D<T> visible{ beg, end };
+            if ((codes[i] | codes[i + 1U]) != Detail::INSIDE)
+            {
+                auto const interval{ Detail::get_visible_interval(beg, end, bounds) };
+                if (!interval.has_value())
+                {
+                    is_run_open = false;
+                    continue;
+                }
+                visible = Detail::get_segment(beg, end, *interval);
+            }
+
+            if (is_run_open && codes[i] == Detail::INSIDE)
+            {
+                res.back().push_back(visible.end);
+            }
+            else
+            {
+                res.push_back(std::vector<Vector2D<T>>{ visible.beg, visible.end });
+            }
+            is_run_open = codes[i + 1U] == Detail::INSIDE;
+        }
+        return res;
+    }
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Rectangle2D.hpp"
+#include "SweptCollision.hpp"
+
+#include <optional>
 
 
 namespace GameEngine::Abstract
@@ -28,5 +31,10 @@ namespace GameEngine::Abstract
         {
             return (this->get_collision_box().get_center() - obj.get_collision_box().get_center()).get_square_length();
         }
+        // Earliest contact while this object moves by displacement and obj stays still
+        std::optional<Geometry::Contact> get_swept_contact(Geometry::Vector2D<float> const& displacement, Collidable const& obj) const noexcept
+        {
+            return Geometry::get_swept_contact(this->get_collision_box(), displacement, obj.get_collision_box());
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Simd.hpp"
+#include "Rectangle2D.hpp"
+
+#include <bit>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace GameEngine::Geometry::CollisionKernels
+{
+    // Kernels over separate arrays of sides of boxes (RectangleBatch<float> and RectangleBatch<int>).
+    // Box k collides with query box under the same test as Rectangle2D::is_colided_with:
+    //     left[k] < box.right && right[k] > box.left && bottom[k] > box.top && top[k] < box.bottom
+    // Results are written as bit mask: bit k % 64 of word k / 64 is set for colliding box k.
+    // int boxes use SSE2 (AVX has no 256-bit integer comparisons), float boxes use AVX if it is available.
+
+    template<typename T>
+    inline constexpr bool has_simd_collisions{ false };
+
+#if defined(GAMEENGINE_SIMD_SSE)
+    template<>
+    inline constexpr bool has_simd_collisions<float>{ true };
+    template<>
+    inline constexpr bool has_simd_collisions<int>{ true };
+#endif
+
+    template<typename T>
+    constexpr bool is_collided(Rectangle2D<T> const& box, T const* left, T const* right, T const* bottom, T const* top, std::size_t k) noexcept
+    {
+        return left[k] < box.right && right[k] > box.left && bottom[k] > box.top && top[k] < box.bottom;
+    }
+
+#if defined(GAMEENGINE_SIMD_SSE)
+    // Bits of collided boxes among 8 (AVX) or 4 (SSE) boxes from k
+#if defined(GAMEENGINE_SIMD_AVX)
+    inline constexpr std::size_t FLOAT_GROUP_SIZE{ 8U };
+
+    inline std::uint32_t get_group_mask(Rectangle2D<float> const& box, float const* left, float const* right, float const* bottom, float const* top, std::size_t k) noexcept
+    {
+        __m256 const is_left { _mm256_cmp_ps(_mm256_loadu_ps(left + k),   _mm256_set1_ps(box.right),  _CMP_LT_OQ) };
+        __m256 const is_right{ _mm256_cmp_ps(_mm256_loadu_ps(right + k),  _mm256_set1_ps(box.left),   _CMP_GT_OQ) };
+        __m256 const is_bot  { _mm256_cmp_ps(_mm256_loadu_ps(bottom + k), _mm256_set1_ps(box.top),    _CMP_GT_OQ) };
+        __m256 const is_top  { _mm256_cmp_ps(_mm256_loadu_ps(top + k),    _mm256_set1_ps(box.bottom), _CMP_LT_OQ) };
+
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(is_left, is_right), _mm256_and_ps(is_bot, is_top))));
+    }
+#else
+    inline constexpr std::size_t FLOAT_GROUP_SIZE{ 4U };
+
+    inline std::uint32_t get_group_mask(Rectangle2D<float> const& box, float const* left, float const* right, float const* bottom, float const* top, std::size_t k) noexcept
+    {
+        __m128 const is_left { _mm_cmplt_ps(_mm_loadu_ps(left + k),   _mm_set1_ps(box.right)) };
+        __m128 const is_right{ _mm_cmpgt_ps(_mm_loadu_ps(right + k),  _mm_set1_ps(box.left)) };
+        __m128 const is_bot  { _mm_cmpgt_ps(_mm_loadu_ps(bottom + k), _mm_set1_ps(box.top)) };
+        __m128 const is_top  { _mm_cmplt_ps(_mm_loadu_ps(top + k),    _mm_set1_ps(box.bottom)) };
+
+        return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_and_ps(_mm_and_ps(is_left, is_right), _mm_and_ps(is_bot, is_top))));
+    }
+#endif
+
+    inline constexpr std::size_t INT_GROUP_SIZE{ 4U };
+
+    inline std::uint32_t get_group_mask(Rectangle2D<int> const& box, int const* left, int const* right, int const* bottom, int const* top, std::size_t k) noexcept
+    {
+        auto const load{ [k](int const* side) noexcept { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(side + k)); } };
+
+        __m128i const is_left { _mm_cmplt_epi32(load(left),   _mm_set1_epi32(box.right)) };
+        __m128i const is_right{ _mm_cmpgt_epi32(load(right),  _mm_set1_epi32(box.left)) };
+        __m128i const is_bot  { _mm_cmpgt_epi32(load(bottom), _mm_set1_epi32(box.top)) };
+        __m128i const is_top  { _mm_cmplt_epi32(load(top),    _mm_set1_epi32(box.bottom)) };
+
+        __m128i const is_hit{ _mm_and_si128(_mm_and_si128(is_left, is_right), _mm_and_si128(is_bot, is_top)) };
+        return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(is_hit)));
+    }
+
+    template<typename T>
+    inline constexpr std::size_t GROUP_SIZE{ std::same_as<T, float> ? FLOAT_GROUP_SIZE : INT_GROUP_SIZE };
+#endif
+
+    // mask must have at least (count + 63) / 64 words
+    template<typename T>
+    void get_collision_mask(Rectangle2D<T> const& box, T const* left, T const* right, T const* bottom, T const* top, std::size_t count, std::uint64_t* mask) noexcept
+    {
+        std::fill_n(mask, (count + 63U) / 64U, std::uint64_t{ 0U });
+
+        std::size_t k{ 0U };
+
+#if defined(GAMEENGINE_SIMD_SSE)
+        if constexpr (has_simd_collisions<T>)
+        {
+            // Group size divides 64, so bits of group never cross word boundary
+            for (; k + GROUP_SIZE<T> <= count; k += GROUP_SIZE<T>)
+            {
+                mask[k / 64U] |= static_cast<std::uint64_t>(get_group_mask(box, left, right, bottom, top, k)) << (k % 64U);
+            }
+        }
+#endif
+
+        for (; k != count; ++k)
+        {
+            mask[k / 64U] |= static_cast<std::uint64_t>(is_collided(box, left, right, bottom, top, k)) << (k % 64U);
+        }
+    }
+
+    // Index of the first colliding box or count if there is none
+    template<typename T>
+    std::size_t find_first_collision(Rectangle2D<T> const& box, T const* left, T const* right, T const* bottom, T const* top, std::size_t count) noexcept
+    {
+        std::size_t k{ 0U };
+
+#if defined(GAMEENGINE_SIMD_SSE)
+        if constexpr (has_simd_collisions<T>)
+        {
+            for (; k + GROUP_SIZE<T> <= count; k += GROUP_SIZE<T>)
+            {
+                if (std::uint32_t const bits{ get_group_mask(box, left, right, bottom, top, k) }; bits != 0U)
+                {
+                    return k + static_cast<std::size_t>(std::countr_zero(bits));
+                }
+            }
+        }
+#endif
+
+        for (; k != count; ++k)
+        {
+            if (is_collided(box, left, right, bottom, top, k)) return k;
+        }
+        return count;
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <concepts>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <type_traits>
+#include <cmath>
+
+
+namespace GameEngine::Geometry::ConstexprMath
+{
+    // Implementations usable in constant expressions. All of them are evaluated in double,
+    // result for float is rounded once. Error bounds (checked by unit test against <cmath>):
+    //     sin, cos:  |x| <= MAX_REDUCIBLE_ARGUMENT,  absolute error <= 2 ulp of double (about 4.5e-16)
+    //                float result is correctly rounded or 1 ulp off
+    //     sqrt:      error <= 1 ulp (Newton iterations until fixed point), exact for perfect squares
+    // Functions of this namespace (not Series) call <cmath> when they are evaluated at run time,
+    // so constant folding costs nothing in accuracy or speed of run-time code.
+    namespace Series
+    {
+        // pi / 2 split into parts with trailing zeros (Cody-Waite), so q * PIO2_1 and q * PIO2_2 are exact for q < 2^20
+        inline constexpr double PIO2_1{ 1.57079632673412561417e+00 };
+        inline constexpr double PIO2_2{ 6.07710050630396597660e-11 };
+        inline constexpr double PIO2_3{ 2.02226624871116645580e-21 };
+
+        inline constexpr double MAX_REDUCIBLE_ARGUMENT{ 1'000'000.0 };
+
+        // x = q * pi / 2 + r, |r| <= pi / 4
+        struct Reduced final
+        {
+            long long q{ 0 };
+            double r{ 0.0 };
+        };
+
+        constexpr Reduced get_reduced(double x)
+        {
+            if (!(x >= -MAX_REDUCIBLE_ARGUMENT && x <= MAX_REDUCIBLE_ARGUMENT)) throw std::domain_error{ "Argument of trigonometric function is out of range" };
+
+            double const scaled{ x * (2.0 / std::numbers::pi) };
+            long long const q{ static_cast<long long>(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5) };
+            double const qd{ static_cast<double>(q) };
+
+            return Reduced{ q, ((x - qd * PIO2_1) - qd * PIO2_2) - qd * PIO2_3 };
+        }
+
+        // Taylor series on |r| <= pi / 4: truncation error is below (pi / 4)^19 / 19! < 1e-19
+        constexpr double get_sin_of_reduced(double r) noexcept
+        {
+            double const r2{ r * r };
+            double term{ r };
+            double sum{ r };
+            for (int n{ 2 }; n != 20; n += 2)
+            {
+                term *= -r2 / static_cast<double>(n * (n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double get_cos_of_reduced(double r) noexcept
+        {
+            double const r2{ r * r };
+            double term{ 1.0 };
+            double sum{ 1.0 };
+            for (int n{ 1 }; n != 19; n += 2)
+            {
+                term *= -r2 / static_cast<double>(n * (n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        template<std::floating_point T>
+        constexpr T sin(T x)
+        {
+            auto const [q, r] { get_reduced(static_cast<double>(x)) };
+            switch (q & 3)
+            {
+            case 0:  return static_cast<T>( get_sin_of_reduced(r));
+            case 1:  return static_cast<T>( get_cos_of_reduced(r));
+            case 2:  return static_cast<T>(-get_sin_of_reduced(r));
+            default: return static_cast<T>(-get_cos_of_reduced(r));
+            }
+        }
+
+        template<std::floating_point T>
+        constexpr T cos(T x)
+        {
+            auto const [q, r] { get_reduced(static_cast<double>(x)) };
+            switch (q & 3)
+            {
+            case 0:  return static_cast<T>( get_cos_of_reduced(r));
+            case 1:  return static_cast<T>(-get_sin_of_reduced(r));
+            case 2:  return static_cast<T>(-get_cos_of_reduced(r));
+            default: return static_cast<T>( get_sin_of_reduced(r));
+            }
+        }
+
+        template<std::floating_point T>
+        constexpr T sqrt(T x) noexcept
+        {
+            if (x != x || x < T{ 0 })                       return std::numeric_limits<T>::quiet_NaN();
+            if (x == T{ 0 } || x == std::numeric_limits<T>::infinity()) return x;
+
+            double const v{ static_cast<double>(x) };
+
+            // Initial guess within factor 2 of the root: v is scaled into [1, 4) by powers of 4
+            double guess{ 1.0 };
+            for (double m{ v }; m >= 4.0; m *= 0.25) guess *= 2.0;
+            for (double m{ v }; m < 1.0;  m *= 4.0)  guess *= 0.5;
+
+            // Newton iterations decrease monotonically after the first one, stop when they no longer do
+            double y{ 0.5 * (guess + v / guess) };
+            for (;;)
+            {
+                double const next{ 0.5 * (y + v / y) };
+                if (next >= y) break;
+                y = next;
+            }
+
+            return static_cast<T>(y);
+        }
+    }
+
+    inline constexpr double MAX_REDUCIBLE_ARGUMENT{ Series::MAX_REDUCIBLE_ARGUMENT };
+
+    // Compile-time evaluation with argument out of range is a compilation error
+    template<std::floating_point T>
+    constexpr T sin(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) return Series::sin(x);
+        else                              return std::sin(x);
+    }
+
+    template<std::floating_point T>
+    constexpr T cos(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) return Series::cos(x);
+        else                              return std::cos(x);
+    }
+
+    template<std::floating_point T>
+    constexpr T sqrt(T x) noexcept
+    {
+        if (std::is_constant_evaluated()) return Series::sqrt(x);
+        else                              return std::sqrt(x);
+    }
+}
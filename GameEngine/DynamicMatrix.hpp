@@ -0,0 +1,396 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "ThreadPool.hpp"
+
+#include <new>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <algorithm>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    // Matrix with sizes known only at runtime. Elements are stored row by row in heap memory
+    // aligned to cache line, so big matrices do not overflow stack.
+    template<arithmetic_like T = double>
+    class DynamicMatrix final
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t ALIGNMENT{ 64U };
+
+    public:
+
+        DynamicMatrix() noexcept = default;
+        DynamicMatrix(std::size_t rows, std::size_t cols)
+        :
+        number_of_rows{ rows },
+        number_of_cols{ cols },
+        data{ allocate(rows * cols) }
+        {
+            try
+            {
+                std::uninitialized_value_construct_n(data, rows * cols);
+            }
+            catch (...)
+            {
+                deallocate(data);
+                throw;
+            }
+        }
+        DynamicMatrix(std::size_t rows, std::size_t cols, std::span<T const> init_data)
+        :
+        number_of_rows{ rows },
+        number_of_cols{ cols },
+        data{ allocate(rows * cols) }
+        {
+            if (init_data.size() != rows * cols)
+            {
+                deallocate(data);
+                throw std::invalid_argument{ "Input range must have size equal to number of elements in matrix" };
+            }
+
+            try
+            {
+                std::uninitialized_copy_n(init_data.begin(), rows * cols, data);
+            }
+            catch (...)
+            {
+                deallocate(data);
+                throw;
+            }
+        }
+        template<std::size_t M, std::size_t N>
+        explicit DynamicMatrix(Matrix<M, N, T> const& m)
+        :
+        DynamicMatrix{ M, N, m.flattern() }
+        { }
+
+        DynamicMatrix(DynamicMatrix const& other)
+        :
+        DynamicMatrix{ other.number_of_rows, other.number_of_cols, other.flattern() }
+        { }
+        DynamicMatrix(DynamicMatrix&& other) noexcept
+        :
+        number_of_rows{ std::exchange(other.number_of_rows, 0U) },
+        number_of_cols{ std::exchange(other.number_of_cols, 0U) },
+        data{ std::exchange(other.data, nullptr) }
+        { }
+
+        DynamicMatrix& operator=(DynamicMatrix const& other)
+        {
+            if (this != &other)
+            {
+                *this = DynamicMatrix{ other };
+            }
+            return *this;
+        }
+        DynamicMatrix& operator=(DynamicMatrix&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                number_of_rows = std::exchange(other.number_of_rows, 0U);
+                number_of_cols = std::exchange(other.number_of_cols, 0U);
+                data           = std::exchange(other.data, nullptr);
+            }
+            return *this;
+        }
+
+        ~DynamicMatrix()
+        {
+            release();
+        }
+
+
+        template<std::size_t M, std::size_t N>
+        Matrix<M, N, T> to_matrix() const
+        {
+            if (number_of_rows != M || number_of_cols != N)
+            {
+                throw std::invalid_argument{ "Sizes of dynamic matrix and requested matrix are different" };
+            }
+
+            std::array<T, M * N> tmp{ };
+            std::copy_n(data, M * N, tmp.begin());
+
+            return Matrix<M, N, T>{ std::move(tmp) };
+        }
+
+        std::size_t get_rows_count() const noexcept
+        {
+            return number_of_rows;
+        }
+        std::size_t get_cols_count() const noexcept
+        {
+            return number_of_cols;
+        }
+
+        T const& operator()(std::size_t i, std::size_t j) const noexcept
+        {
+            assert(("Requested row's index must be lesser than number of matrix rows", i < number_of_rows));
+            assert(("Requested column's index must be lesser than number of matrix columns", j < number_of_cols));
+
+            return data[i * number_of_cols + j];
+        }
+        T& operator()(std::size_t i, std::size_t j) noexcept
+        {
+            assert(("Requested row's index must be lesser than number of matrix rows", i < number_of_rows));
+            assert(("Requested column's index must be lesser than number of matrix columns", j < number_of_cols));
+
+            return data[i * number_of_cols + j];
+        }
+
+        std::span<T const> operator[](std::size_t row) const noexcept
+        {
+            assert(("Requested row's index must be lesser than number of matrix rows", row < number_of_rows));
+
+            return std::span<T const>{ data + row * number_of_cols, number_of_cols };
+        }
+        std::span<T> operator[](std::size_t row) noexcept
+        {
+            assert(("Requested row's index must be lesser than number of matrix rows", row < number_of_rows));
+
+            return std::span<T>{ data + row * number_of_cols, number_of_cols };
+        }
+
+        std::span<T const> flattern() const noexcept
+        {
+            return std::span<T const>{ data, number_of_rows * number_of_cols };
+        }
+        std::span<T> flattern() noexcept
+        {
+            return std::span<T>{ data, number_of_rows * number_of_cols };
+        }
+
+        DynamicMatrix& operator+=(DynamicMatrix const& rhs)
+        {
+            check_same_sizes(*this, rhs);
+            std::ranges::transform(flattern(), rhs.flattern(), data, std::plus<T>{});
+            return *this;
+        }
+        DynamicMatrix& operator-=(DynamicMatrix const& rhs)
+        {
+            check_same_sizes(*this, rhs);
+            std::ranges::transform(flattern(), rhs.flattern(), data, std::minus<T>{});
+            return *this;
+        }
+        DynamicMatrix& operator*=(T const& rhs) noexcept(noexcept(std::declval<T const&>() * std::declval<T const&>()))
+        {
+            std::ranges::transform(flattern(), data, [&rhs](auto const& val) noexcept { return rhs * val; });
+            return *this;
+        }
+        DynamicMatrix& operator/=(T const& rhs) noexcept(noexcept(std::declval<T const&>() / std::declval<T const&>()))
+        {
+            std::ranges::transform(flattern(), data, [&rhs](auto const& val) noexcept { return val / rhs; });
+            return *this;
+        }
+
+        friend DynamicMatrix operator+(DynamicMatrix lhs, DynamicMatrix const& rhs)
+        {
+            return lhs += rhs;
+        }
+        friend DynamicMatrix operator-(DynamicMatrix lhs, DynamicMatrix const& rhs)
+        {
+            return lhs -= rhs;
+        }
+        friend DynamicMatrix operator*(DynamicMatrix lhs, T const& rhs)
+        {
+            return lhs *= rhs;
+        }
+        friend DynamicMatrix operator*(T const& lhs, DynamicMatrix rhs)
+        {
+            return rhs *= lhs;
+        }
+        friend DynamicMatrix operator/(DynamicMatrix lhs, T const& rhs)
+        {
+            return lhs /= rhs;
+        }
+
+        friend bool operator==(DynamicMatrix const& lhs, DynamicMatrix const& rhs) noexcept
+        {
+            if (lhs.number_of_rows != rhs.number_of_rows || lhs.number_of_cols != rhs.number_of_cols) return false;
+
+            if constexpr (std::floating_point<T>)
+            {
+                return std::ranges::equal(lhs.flattern(), rhs.flattern(), [](T a, T b) noexcept { return Auxiliry::is_equal_with_precision(a, b); });
+            }
+            else
+            {
+                return std::ranges::equal(lhs.flattern(), rhs.flattern());
+            }
+        }
+        friend bool operator!=(DynamicMatrix const& lhs, DynamicMatrix const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        static void check_same_sizes(DynamicMatrix const& lhs, DynamicMatrix const& rhs)
+        {
+            if (lhs.number_of_rows != rhs.number_of_rows || lhs.number_of_cols != rhs.number_of_cols)
+            {
+                throw std::invalid_argument{ "Matrices must have the same sizes" };
+            }
+        }
+
+    private:
+
+        static T* allocate(std::size_t n)
+        {
+            if (n == 0U) return nullptr;
+            return static_cast<T*>(::operator new[](n * sizeof(T), std::align_val_t{ ALIGNMENT }));
+        }
+        static void deallocate(T* ptr) noexcept
+        {
+            if (ptr != nullptr) ::operator delete[](ptr, std::align_val_t{ ALIGNMENT });
+        }
+
+        void release() noexcept
+        {
+            if (data != nullptr)
+            {
+                std::destroy_n(data, number_of_rows * number_of_cols);
+                deallocate(data);
+                data = nullptr;
+            }
+        }
+
+    private:
+
+        std::size_t number_of_rows{ 0U };
+        std::size_t number_of_cols{ 0U };
+
+        T* data{ nullptr };
+    };
+
+    // Reference implementation of the product: plain triple loop without blocking
+    template<typename T>
+    DynamicMatrix<T> multiply_generic(DynamicMatrix<T> const& lhs, DynamicMatrix<T> const& rhs)
+    {
+        if (lhs.get_cols_count() != rhs.get_rows_count())
+        {
+            throw std::invalid_argument{ "Number of columns of left matrix must be equal to number of rows of right one" };
+        }
+
+        std::size_t const M{ lhs.get_rows_count() };
+        std::size_t const N{ lhs.get_cols_count() };
+        std::size_t const K{ rhs.get_cols_count() };
+
+        DynamicMatrix<T> mul_result{ M, K };
+
+        for (std::size_t left_row{ 0U }; left_row != M; ++left_row)
+        for (std::size_t right_col{ 0U }; right_col != K; ++right_col)
+        for (std::size_t i{ 0U }; i != N; ++i)
+            mul_result(left_row, right_col) = mul_result(left_row, right_col) + lhs(left_row, i) * rhs(i, right_col);
+
+        return mul_result;
+    }
+
+    // Cache-blocked product. Rows of result are split into bands of BLOCK_SIZE rows,
+    // each band is computed independently, so bands are distributed among pool's workers when pool is given.
+    template<typename T>
+    DynamicMatrix<T> multiply_blocked(DynamicMatrix<T> const& lhs, DynamicMatrix<T> const& rhs, Threading::ThreadPool* pool = nullptr)
+    {
+        static constexpr std::size_t BLOCK_SIZE{ 64U };
+
+        if (lhs.get_cols_count() != rhs.get_rows_count())
+        {
+            throw std::invalid_argument{ "Number of columns of left matrix must be equal to number of rows of right one" };
+        }
+
+        std::size_t const M{ lhs.get_rows_count() };
+        std::size_t const N{ lhs.get_cols_count() };
+        std::size_t const K{ rhs.get_cols_count() };
+
+        DynamicMatrix<T> mul_result{ M, K };
+
+        T const* const a{ lhs.flattern().data() };
+        T const* const b{ rhs.flattern().data() };
+        T* const c{ mul_result.flattern().data() };
+
+        auto const compute_band
+        {
+            [=](std::size_t band) noexcept(noexcept(std::declval<T const&>() * std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()))
+            {
+                std::size_t const i_beg{ band * BLOCK_SIZE };
+                std::size_t const i_end{ std::min(i_beg + BLOCK_SIZE, M) };
+
+                for (std::size_t k_beg{ 0U }; k_beg < N; k_beg += BLOCK_SIZE)
+                {
+                    std::size_t const k_end{ std::min(k_beg + BLOCK_SIZE, N) };
+
+                    for (std::size_t j_beg{ 0U }; j_beg < K; j_beg += BLOCK_SIZE)
+                    {
+                        std::size_t const j_end{ std::min(j_beg + BLOCK_SIZE, K) };
+
+                        // i-k-j order keeps innermost loop contiguous for both rhs and result
+                        for (std::size_t i{ i_beg }; i != i_end; ++i)
+                        for (std::size_t k{ k_beg }; k != k_end; ++k)
+                        {
+                            T const a_ik{ a[i * N + k] };
+                            T const* const b_row{ b + k * K };
+                            T* const c_row{ c + i * K };
+
+                            for (std::size_t j{ j_beg }; j != j_end; ++j)
+                            {
+                                c_row[j] = c_row[j] + a_ik * b_row[j];
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        std::size_t const n_bands{ (M + BLOCK_SIZE - 1U) / BLOCK_SIZE };
+        if (pool != nullptr && n_bands > 1U)
+        {
+            pool->parallel_for(n_bands, compute_band);
+        }
+        else
+        {
+            for (std::size_t band{ 0U }; band != n_bands; ++band)
+            {
+                compute_band(band);
+            }
+        }
+
+        return mul_result;
+    }
+
+    template<typename T>
+    DynamicMatrix<T> operator*(DynamicMatrix<T> const& lhs, DynamicMatrix<T> const& rhs)
+    {
+        return multiply_blocked(lhs, rhs);
+    }
+
+    template<typename T>
+    DynamicMatrix<T> get_transponsed(DynamicMatrix<T> const& m)
+    {
+        DynamicMatrix<T> tmp{ m.get_cols_count(), m.get_rows_count() };
+
+        for (std::size_t i{ 0U }; i != m.get_rows_count(); ++i)
+        for (std::size_t j{ 0U }; j != m.get_cols_count(); ++j)
+        {
+            tmp(j, i) = m(i, j);
+        }
+
+        return tmp;
+    }
+
+    template<typename T = double>
+    DynamicMatrix<T> get_dynamic_identity(std::size_t size)
+    {
+        DynamicMatrix<T> tmp{ size, size };
+
+        for (std::size_t i{ 0U }; i != size; ++i)
+        {
+            tmp(i, i) = T{ 1 };
+        }
+
+        return tmp;
+    }
+}
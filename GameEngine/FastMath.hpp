@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Simd.hpp"
+#include "Vector2D.hpp"
+#include "ConstexprMath.hpp"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+
+namespace GameEngine::Geometry::FastMath
+{
+    // Opt-in approximations of <cmath> functions for float, chosen per call site by calling them instead of std ones.
+    // Maximum errors below are measured against double-precision <cmath> and checked by unit test:
+    //     get_rsqrt:     x is positive normal float,  relative error <= 3e-7  (SSE: rsqrtss and one Newton step)
+    //                                                 relative error <= 5e-6  (no SSE: integer guess and two Newton steps)
+    //     get_sincos:    any x,                       absolute error <= 2e-7  (|x| > MAX_SINCOS_ARGUMENT falls back to <cmath>)
+    //     get_table_sin: |x| <= 2 * pi,               absolute error <= 8e-5  (256 points, linear interpolation)
+    //                    |x| <= 1000,                 absolute error <= 2e-4
+    // Functions for Vector2D<float> are built on them and have the same relative errors.
+
+    inline constexpr float MAX_SINCOS_ARGUMENT{ 8192.f };
+
+    inline constexpr std::size_t SIN_TABLE_SIZE{ 256U };
+
+    // 1 / sqrt(x)
+    inline float get_rsqrt(float x) noexcept
+    {
+#if defined(GAMEENGINE_SIMD_SSE)
+        float const y{ _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x))) };
+#else
+        // Exponent of x is halved and negated by integer arithmetic, the guess is within 3.5% of the result
+        float y{ std::bit_cast<float>(0x5F375A86U - (std::bit_cast<std::uint32_t>(x) >> 1U)) };
+        y = y * (1.5f - 0.5f * x * y * y);
+#endif
+        // Newton step squares relative error of the guess
+        return y * (1.5f - 0.5f * x * y * y);
+    }
+
+    struct SinCos final
+    {
+        float sin{ 0.f };
+        float cos{ 0.f };
+    };
+
+    // Both values share range reduction to |r| <= pi / 4, then minimax polynomials of degree 7 and 8 (Cephes).
+    // It is faster than std::sin with std::cos of glibc only when polynomials are contracted to FMA (-mfma, -march=native),
+    // for baseline x86-64 (SSE2) and SSE4.1 both take about the same time, so it is worth only for the FMA target
+    inline SinCos get_sincos(float x) noexcept
+    {
+        if (!(std::abs(x) <= MAX_SINCOS_ARGUMENT)) return SinCos{ std::sin(x), std::cos(x) };
+
+        // pi / 2 split into parts with trailing zeros, so q * PIO2_1 and q * PIO2_2 are exact for |q| < 2^13
+        constexpr float PIO2_1{ 1.5703125f };
+        constexpr float PIO2_2{ 4.837512969970703125e-4f };
+        constexpr float PIO2_3{ 7.54978995489188216e-8f };
+
+        float const scaled{ x * static_cast<float>(2. / std::numbers::pi) };
+        int const q{ static_cast<int>(scaled >= 0.f ? scaled + 0.5f : scaled - 0.5f) };
+        float const qf{ static_cast<float>(q) };
+
+        float const r{ ((x - qf * PIO2_1) - qf * PIO2_2) - qf * PIO2_3 };
+        float const r2{ r * r };
+
+        float const s{ r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f)) };
+        float const c{ 1.f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f)) };
+
+        // Quadrant is applied by selects and sign flips instead of switch, so loops over arguments have no branches:
+        // q = 0: (s, c), q = 1: (c, -s), q = 2: (-s, -c), q = 3: (-c, s)
+        bool const is_swapped{ (q & 1) != 0 };
+        float const sin_sign{ (q & 2) != 0 ? -1.f : 1.f };
+        float const cos_sign{ ((q + 1) & 2) != 0 ? -1.f : 1.f };
+
+        return SinCos{ (is_swapped ? c : s) * sin_sign, (is_swapped ? s : c) * cos_sign };
+    }
+
+    inline float get_sin(float x) noexcept
+    {
+        return get_sincos(x).sin;
+    }
+    inline float get_cos(float x) noexcept
+    {
+        return get_sincos(x).cos;
+    }
+
+    // Values of sin at SIN_TABLE_SIZE + 1 points of [0, 2 * pi], computed at compile time
+    inline constexpr std::array<float, SIN_TABLE_SIZE + 1U> SIN_TABLE
+    {
+        []() consteval
+        {
+            std::array<float, SIN_TABLE_SIZE + 1U> res{ };
+            for (std::size_t i{ 0U }; i != res.size(); ++i)
+            {
+                res[i] = static_cast<float>(ConstexprMath::Series::sin(2. * std::numbers::pi * static_cast<double>(i) / static_cast<double>(SIN_TABLE_SIZE)));
+            }
+            return res;
+        }()
+    };
+
+    // For periodic effects where a few significant digits are enough (e.g. pulsation of colour).
+    // Error of linear interpolation is (2 * pi / SIN_TABLE_SIZE)^2 / 8 = 7.5e-5, bigger arguments also lose
+    // precision of float when they are scaled to table index
+    inline float get_table_sin(float x) noexcept
+    {
+        float const t{ x * static_cast<float>(SIN_TABLE_SIZE / (2. * std::numbers::pi)) };
+
+        std::int64_t whole{ static_cast<std::int64_t>(t) };
+        if (t < static_cast<float>(whole)) --whole;
+
+        float const fraction{ t - static_cast<float>(whole) };
+        std::size_t const i{ static_cast<std::size_t>(whole) & (SIN_TABLE_SIZE - 1U) };
+
+        return SIN_TABLE[i] + (SIN_TABLE[i + 1U] - SIN_TABLE[i]) * fraction;
+    }
+
+    // Vectors not longer than 1e-5 are returned unchanged, as by Vector2D::get_normalized
+    inline Vector2D<float> get_normalized(Vector2D<float> const& vec) noexcept
+    {
+        float const square_length{ vec.x * vec.x + vec.y * vec.y };
+        if (square_length <= 1e-10f) return vec;
+
+        float const k{ get_rsqrt(square_length) };
+        return Vector2D<float>{ vec.x * k, vec.y * k };
+    }
+
+    // Rotation computed in float with get_sincos, unlike Vector2D::get_rotated which uses double
+    inline Vector2D<float> get_rotated(Vector2D<float> const& vec, float radians) noexcept
+    {
+        auto const [s, c] { get_sincos(radians) };
+        return Vector2D<float>{ vec.x * c - vec.y * s, vec.x * s + vec.y * c };
+    }
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Auxiliry.hpp"
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry
+{
+    enum class FixedPointOverflow
+    {
+        WRAP,     // result is taken modulo 2^bits, as for unsigned integers
+        SATURATE  // result is clamped to the representable range
+    };
+
+    // Signed fixed-point number Qm.n: raw integer R stands for R / 2^FRACTION_BITS,
+    // m = bits of R - FRACTION_BITS (sign included). The same operations give the same bits
+    // with any compiler and any floating-point settings.
+    // Intermediate results are computed in 64 bits, so product and quotient cost one integer
+    // multiplication or division and one shift. Conversion from floating-point is always saturated.
+    template<std::signed_integral R, std::size_t FRACTION_BITS, FixedPointOverflow OVERFLOW = FixedPointOverflow::WRAP>
+    requires (sizeof(R) <= sizeof(std::int32_t) && FRACTION_BITS < std::numeric_limits<R>::digits)
+    class FixedPoint final
+    {
+    public:
+
+        using raw_type = R;
+
+        static constexpr std::size_t NUMBER_OF_FRACTION_BITS{ FRACTION_BITS };
+        static constexpr FixedPointOverflow OVERFLOW_POLICY{ OVERFLOW };
+
+    public:
+
+        constexpr FixedPoint() noexcept = default;
+
+        template<std::integral I>
+        constexpr explicit FixedPoint(I value) noexcept
+        :
+        raw{ get_from_wide(get_clamped_to_wide(value) * ONE) }
+        { }
+
+        template<std::floating_point F>
+        constexpr explicit FixedPoint(F value) noexcept
+        :
+        raw{ get_from_floating(static_cast<double>(value)) }
+        { }
+
+        constexpr FixedPoint(FixedPoint const&) noexcept = default;
+        constexpr FixedPoint(FixedPoint&&)      noexcept = default;
+
+        constexpr FixedPoint& operator=(FixedPoint const&) noexcept = default;
+        constexpr FixedPoint& operator=(FixedPoint&&)      noexcept = default;
+
+        constexpr ~FixedPoint() noexcept = default;
+
+        static constexpr FixedPoint from_raw(R value) noexcept
+        {
+            FixedPoint res{ };
+            res.raw = value;
+            return res;
+        }
+
+        static constexpr FixedPoint get_max() noexcept
+        {
+            return from_raw(std::numeric_limits<R>::max());
+        }
+        static constexpr FixedPoint get_min() noexcept
+        {
+            return from_raw(std::numeric_limits<R>::min());
+        }
+        // Distance between neighbour values, 2^-FRACTION_BITS
+        static constexpr FixedPoint get_epsilon() noexcept
+        {
+            return from_raw(R{ 1 });
+        }
+
+
+        constexpr R get_raw() const noexcept
+        {
+            return raw;
+        }
+
+        template<std::floating_point F>
+        constexpr explicit operator F() const noexcept
+        {
+            return static_cast<F>(raw) / static_cast<F>(ONE);
+        }
+
+        // Fraction is truncated toward zero, as for conversion of floating-point number
+        template<std::integral I>
+        constexpr explicit operator I() const noexcept
+        {
+            return static_cast<I>(static_cast<std::int64_t>(raw) / ONE);
+        }
+
+
+        constexpr FixedPoint operator-() const noexcept
+        {
+            return from_raw(get_from_wide(-static_cast<std::int64_t>(raw)));
+        }
+        constexpr FixedPoint operator+() const noexcept
+        {
+            return *this;
+        }
+
+        constexpr FixedPoint& operator+=(FixedPoint const& rhs) noexcept
+        {
+            raw = get_from_wide(static_cast<std::int64_t>(raw) + rhs.raw);
+            return *this;
+        }
+        constexpr FixedPoint& operator-=(FixedPoint const& rhs) noexcept
+        {
+            raw = get_from_wide(static_cast<std::int64_t>(raw) - rhs.raw);
+            return *this;
+        }
+        // Product is rounded toward negative infinity (arithmetic shift)
+        constexpr FixedPoint& operator*=(FixedPoint const& rhs) noexcept
+        {
+            raw = get_from_wide((static_cast<std::int64_t>(raw) * rhs.raw) >> FRACTION_BITS);
+            return *this;
+        }
+        // Quotient is truncated toward zero
+        constexpr FixedPoint& operator/=(FixedPoint const& rhs) noexcept
+        {
+            assert(("Division by zero", rhs.raw != R{ 0 }));
+            raw = get_from_wide((static_cast<std::int64_t>(raw) * ONE) / rhs.raw);
+            return *this;
+        }
+
+        friend constexpr FixedPoint operator+(FixedPoint lhs, FixedPoint const& rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+        friend constexpr FixedPoint operator-(FixedPoint lhs, FixedPoint const& rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+        friend constexpr FixedPoint operator*(FixedPoint lhs, FixedPoint const& rhs) noexcept
+        {
+            return lhs *= rhs;
+        }
+        friend constexpr FixedPoint operator/(FixedPoint lhs, FixedPoint const& rhs) noexcept
+        {
+            return lhs /= rhs;
+        }
+
+        friend constexpr bool operator==(FixedPoint const&, FixedPoint const&) noexcept = default;
+        friend constexpr auto operator<=>(FixedPoint const&, FixedPoint const&) noexcept = default;
+
+    private:
+
+        static constexpr std::int64_t ONE{ std::int64_t{ 1 } << FRACTION_BITS };
+
+        static constexpr std::int64_t RAW_MAX{ std::numeric_limits<R>::max() };
+        static constexpr std::int64_t RAW_MIN{ std::numeric_limits<R>::min() };
+
+        static constexpr R get_from_wide(std::int64_t value) noexcept
+        {
+            if constexpr (OVERFLOW == FixedPointOverflow::SATURATE)
+            {
+                return static_cast<R>(value > RAW_MAX ? RAW_MAX : value < RAW_MIN ? RAW_MIN : value);
+            }
+            else
+            {
+                // Conversion to signed type is modular since C++20
+                return static_cast<R>(static_cast<std::make_unsigned_t<R>>(static_cast<std::uint64_t>(value)));
+            }
+        }
+
+        // Integer is reduced to range where its product with ONE fits into 64 bits, without changing the result
+        template<std::integral I>
+        static constexpr std::int64_t get_clamped_to_wide(I value) noexcept
+        {
+            if constexpr (OVERFLOW == FixedPointOverflow::SATURATE)
+            {
+                constexpr std::int64_t LIMIT{ std::numeric_limits<std::int64_t>::max() >> 32 };
+                if constexpr (std::signed_integral<I>) return value > LIMIT ? LIMIT : value < -LIMIT ? -LIMIT : static_cast<std::int64_t>(value);
+                else                                   return value > static_cast<std::uint64_t>(LIMIT) ? LIMIT : static_cast<std::int64_t>(value);
+            }
+            else
+            {
+                // Only low bits of raw value are kept, so high bits of integer may be dropped beforehand
+                return static_cast<std::int64_t>(static_cast<std::uint32_t>(static_cast<std::uint64_t>(value)));
+            }
+        }
+
+        static constexpr R get_from_floating(double value) noexcept
+        {
+            double const scaled{ value * static_cast<double>(ONE) };
+            if (scaled != scaled)                          return R{ 0 };
+            if (scaled >= static_cast<double>(RAW_MAX))    return static_cast<R>(RAW_MAX);
+            if (scaled <= static_cast<double>(RAW_MIN))    return static_cast<R>(RAW_MIN);
+
+            return static_cast<R>(static_cast<std::int64_t>(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5));
+        }
+
+    private:
+
+        R raw{ 0 };
+    };
+
+    using Q16_16    = FixedPoint<std::int32_t, 16U>;
+    using Q16_16Sat = FixedPoint<std::int32_t, 16U, FixedPointOverflow::SATURATE>;
+
+    static_assert(arithmetic_like<Q16_16>);
+    static_assert(arithmetic_like<Q16_16Sat>);
+    static_assert(sizeof(Q16_16) == sizeof(std::int32_t));
+}
@@ -53,46 +53,18 @@ namespace GameEngine
 
     void GameEngine::GraphicsDirect2D::draw_line(Geometry::Vector2D<int> beg, Geometry::Vector2D<int> end, int stroke_width, Colour c, Geometry::Rectangle2D<int> const& clipping_area)
     {
-        // Yeah, I know that algorithm below for clipping is dumb
-        // But I'm in hurry, so let it be
-
         assert(composing_frame);
-        assert(beg.x >= 0 && beg.x <= get_screen_width());
-        assert(beg.y >= 0 && beg.y <= get_screen_height());
-        assert(end.x >= 0 && end.x <= get_screen_width());
-        assert(end.y >= 0 && end.y <= get_screen_height());
+        assert(clipping_area.left >= 0 && clipping_area.left <= get_screen_width());
+        assert(clipping_area.right >= 0 && clipping_area.right <= get_screen_width());
+        assert(clipping_area.bottom >= 0 && clipping_area.bottom <= get_screen_height());
+        assert(clipping_area.top >= 0 && clipping_area.top <= get_screen_height());
         assert(stroke_width > 0);
 
-        int const delta_y{ max(beg.y, end.y) - min(beg.y, beg.y) };
-        int const delta_x{ max(beg.x, end.x) - min(beg.x, end.x) };
-
-
-        if (delta_x == 0)
+        // Ends may be anywhere, only visible part of line is drawn
+        if (auto const visible{ Geometry::Clipping::clip_segment(beg, end, clipping_area) }; visible.has_value())
         {
-            if (beg.y > end.y) std::swap(beg, end);
-
-            if (beg.x < min(clipping_area.left, clipping_area.right) || beg.x > max(clipping_area.left, clipping_area.right)) return;
-            if (beg.y > max(clipping_area.bottom, clipping_area.top) || end.y < min(clipping_area.bottom, clipping_area.top)) return;
-
-            beg.y = std::clamp(beg.y, min(clipping_area.bottom, clipping_area.top), max(clipping_area.bottom, clipping_area.top));
-            end.y = std::clamp(end.y, min(clipping_area.bottom, clipping_area.top), max(clipping_area.bottom, clipping_area.top));
-        }
-        else if (delta_y == 0)
-        {
-            if (beg.x > end.x) std::swap(beg, end);
-
-            if (beg.y < min(clipping_area.bottom, clipping_area.top) || beg.y > max(clipping_area.bottom, clipping_area.top)) return;
-            if (beg.x > max(clipping_area.left, clipping_area.right) || end.x < min(clipping_area.left, clipping_area.right)) return;
-
-            beg.x = std::clamp(beg.x, min(clipping_area.left, clipping_area.right), max(clipping_area.left, clipping_area.right));
-            end.x = std::clamp(end.x, min(clipping_area.left, clipping_area.right), max(clipping_area.left, clipping_area.right));
-        }
-        else
-        {
-            if (!clipping_area.contains(beg) || !clipping_area.contains(end)) return;
+            draw_line(visible->beg, visible->end, stroke_width, c);
         }
-
-        draw_line(beg, end, stroke_width, c);
     }
 
     void GraphicsDirect2D::fill_rectangle(Geometry::Rectangle2D<int> const& rect, Colour c)
@@ -295,6 +267,40 @@ namespace GameEngine
         d2d_factory.get_render_target().FillGeometry(&d2d_factory.get_geometry(), &brush);
     }
 
+    void GraphicsDirect2D::draw_polygon(std::vector<Geometry::Vector2D<int>> const& points, int stroke_width, Colour c, Geometry::Rectangle2D<int> const& clipping_area)
+    {
+        assert(!points.empty());
+        assert(stroke_width > 0);
+
+        if (std::ranges::all_of(points, [&clipping_area](Geometry::Vector2D<int> const& point) { return clipping_area.contains(point); }))
+        {
+            draw_polygon(points, stroke_width, c);
+            return;
+        }
+
+        // Outline is clipped as closed polyline, since sides of clipping area are not part of it
+        std::vector<Geometry::Vector2D<int>> outline{ points };
+        outline.push_back(points.front());
+
+        for (auto const& run : Geometry::Clipping::clip_polyline<int>(outline, clipping_area))
+        {
+            for (std::size_t i{ 1U }; i != run.size(); ++i)
+            {
+                draw_line(run[i - 1U], run[i], stroke_width, c);
+            }
+        }
+    }
+
+    void GraphicsDirect2D::fill_polygon(std::vector<Geometry::Vector2D<int>> const& points, Colour c, Geometry::Rectangle2D<int> const& clipping_area)
+    {
+        assert(!points.empty());
+
+        if (std::vector<Geometry::Vector2D<int>> const visible{ Geometry::Clipping::clip_polygon<int>(points, clipping_area) }; !visible.empty())
+        {
+            fill_polygon(visible, c);
+        }
+    }
+
     void GraphicsDirect2D::draw_text(std::wstring_view text, Colour c, DWriteFontNames font, int font_size, int font_weight, Geometry::Rectangle2D<int> const& clipping_area, DWriteFontStyles style, DWriteFontStretch stretch, DWriteTextHorizontalAlignment align1, DWriteTextVerticalAlignment align2)
     {
         assert(text.size() > 0);
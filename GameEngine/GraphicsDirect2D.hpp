@@ -4,6 +4,9 @@
 #include "Direct2DFactory.hpp"
 
 #include "Surface.hpp"
+#include "Clipping.hpp"
+
+#include <algorithm>
 
 
 namespace GameEngine
@@ -41,6 +44,8 @@ namespace GameEngine
 
         void draw_polygon(std::vector<Geometry::Vector2D<int>> const& points, int stroke_width, Colour c) override;
         void fill_polygon(std::vector<Geometry::Vector2D<int>> const& points, Colour c) override;
+        void draw_polygon(std::vector<Geometry::Vector2D<int>> const& points, int stroke_width, Colour c, Geometry::Rectangle2D<int> const& clipping_area) override;
+        void fill_polygon(std::vector<Geometry::Vector2D<int>> const& points, Colour c, Geometry::Rectangle2D<int> const& clipping_area) override;
 
         void draw_text(std::wstring_view text, Colour c, DWriteFontNames font, int font_size, int font_weight, Geometry::Rectangle2D<int> const& clipping_area, DWriteFontStyles style = DWriteFontStyles::NORMAL, DWriteFontStretch stretch = DWriteFontStretch::NORMAL, DWriteTextHorizontalAlignment align1 = DWriteTextHorizontalAlignment::LEFT, DWriteTextVerticalAlignment align2 = DWriteTextVerticalAlignment::TOP) override;
 
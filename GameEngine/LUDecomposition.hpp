@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <limits>
+#include <algorithm>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    // PA = LU factorization with partial pivoting (row with the largest magnitude in column becomes pivot).
+    // Factorization is done once in constructor, then determinant, solutions and inverse reuse it.
+    // L has unit diagonal and is stored with U in single matrix.
+    template<std::size_t M, std::floating_point T = double>
+    class LUDecomposition final
+    {
+    public:
+
+        constexpr explicit LUDecomposition(Matrix<M, M, T> const& m) noexcept
+        {
+            auto const m_data{ m.flattern() };
+            T max_abs{ ZERO };
+            for (std::size_t i{ 0U }; i != M * M; ++i)
+            {
+                lu[i] = m_data[i];
+                max_abs = std::max(max_abs, get_abs(m_data[i]));
+            }
+
+            // Pivot is compared with the largest element instead of fixed precision, so scaling of matrix
+            // doesn't change whether it is singular. Below this bound pivot is rounding error of elimination
+            T const tolerance{ std::numeric_limits<T>::epsilon() * static_cast<T>(M) * max_abs };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                permutation[i] = i;
+            }
+
+            for (std::size_t I{ 0U }; I != M; ++I)
+            {
+                std::size_t pivot{ I };
+                for (std::size_t i{ I + 1U }; i != M; ++i)
+                {
+                    if (get_abs(lu[i * M + I]) > get_abs(lu[pivot * M + I])) pivot = i;
+                }
+
+                if (get_abs(lu[pivot * M + I]) <= tolerance)
+                {
+                    singular = true;
+                    continue;
+                }
+
+                if (pivot != I)
+                {
+                    for (std::size_t j{ 0U }; j != M; ++j)
+                    {
+                        std::swap(lu[I * M + j], lu[pivot * M + j]);
+                    }
+                    std::swap(permutation[I], permutation[pivot]);
+                    odd_permutation = !odd_permutation;
+                }
+
+                for (std::size_t i{ I + 1U }; i != M; ++i)
+                {
+                    T const k{ lu[i * M + I] / lu[I * M + I] };
+                    lu[i * M + I] = k;
+
+                    for (std::size_t j{ I + 1U }; j != M; ++j)
+                    {
+                        lu[i * M + j] = lu[i * M + j] - k * lu[I * M + j];
+                    }
+                }
+            }
+        }
+
+        constexpr LUDecomposition(LUDecomposition const&) = default;
+        constexpr LUDecomposition(LUDecomposition&&)      = default;
+
+        constexpr LUDecomposition& operator=(LUDecomposition const&) = default;
+        constexpr LUDecomposition& operator=(LUDecomposition&&)      = default;
+
+        constexpr ~LUDecomposition() = default;
+
+
+        constexpr bool is_singular() const noexcept
+        {
+            return singular;
+        }
+
+        constexpr T get_determinant() const noexcept
+        {
+            if (singular) return ZERO;
+
+            T D{ odd_permutation ? MINUS : ONE };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                D = D * lu[i * M + i];
+            }
+
+            return D;
+        }
+
+        // Solves A * X = B for every column of B at once
+        template<std::size_t K>
+        constexpr Matrix<M, K, T> solve(Matrix<M, K, T> const& b) const
+        {
+            if (singular) throw std::runtime_error{ "Matrix is singular" };
+
+            auto const b_data{ b.flattern() };
+            std::array<T, M * K> x{ };
+
+            for (std::size_t i{ 0U }; i != M; ++i)
+            for (std::size_t j{ 0U }; j != K; ++j)
+            {
+                x[i * K + j] = b_data[permutation[i] * K + j];
+            }
+
+            substitute<K>(x);
+
+            return Matrix<M, K, T>{ std::move(x) };
+        }
+
+        constexpr Matrix<M, M, T> get_inversed() const
+        {
+            if (singular) throw std::runtime_error{ "Matrix is singular" };
+
+            std::array<T, M * M> x{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                x[i * M + permutation[i]] = ONE;
+            }
+
+            substitute<M>(x);
+
+            return Matrix<M, M, T>{ std::move(x) };
+        }
+
+        constexpr Matrix<M, M, T> get_lower() const noexcept
+        {
+            std::array<T, M * M> l{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                for (std::size_t j{ 0U }; j != i; ++j)
+                {
+                    l[i * M + j] = lu[i * M + j];
+                }
+                l[i * M + i] = ONE;
+            }
+
+            return Matrix<M, M, T>{ std::move(l) };
+        }
+
+        constexpr Matrix<M, M, T> get_upper() const noexcept
+        {
+            std::array<T, M * M> u{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            for (std::size_t j{ i }; j != M; ++j)
+            {
+                u[i * M + j] = lu[i * M + j];
+            }
+
+            return Matrix<M, M, T>{ std::move(u) };
+        }
+
+        // P such that P * A == L * U
+        constexpr Matrix<M, M, T> get_permutation() const noexcept
+        {
+            std::array<T, M * M> p{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                p[i * M + permutation[i]] = ONE;
+            }
+
+            return Matrix<M, M, T>{ std::move(p) };
+        }
+
+    private:
+
+        static constexpr T ZERO { 0 };
+        static constexpr T ONE  { 1 };
+        static constexpr T MINUS{ -1 };
+
+        static constexpr T get_abs(T val) noexcept
+        {
+            return val < ZERO ? -val : val;
+        }
+
+        // Forward substitution with L, then backward one with U, in place
+        template<std::size_t K>
+        constexpr void substitute(std::array<T, M * K>& x) const noexcept
+        {
+            for (std::size_t i{ 1U }; i < M; ++i)
+            for (std::size_t k{ 0U }; k != i; ++k)
+            {
+                T const l_ik{ lu[i * M + k] };
+                for (std::size_t j{ 0U }; j != K; ++j)
+                {
+                    x[i * K + j] = x[i * K + j] - l_ik * x[k * K + j];
+                }
+            }
+
+            for (std::size_t i{ M }; i != 0U; --i)
+            {
+                std::size_t const I{ i - 1U };
+                for (std::size_t k{ I + 1U }; k < M; ++k)
+                {
+                    T const u_ik{ lu[I * M + k] };
+                    for (std::size_t j{ 0U }; j != K; ++j)
+                    {
+                        x[I * K + j] = x[I * K + j] - u_ik * x[k * K + j];
+                    }
+                }
+                for (std::size_t j{ 0U }; j != K; ++j)
+                {
+                    x[I * K + j] = x[I * K + j] / lu[I * M + I];
+                }
+            }
+        }
+
+    private:
+
+        std::array<T, M * M>       lu{ };
+        std::array<std::size_t, M> permutation{ };
+
+        bool odd_permutation{ false };
+        bool singular{ false };
+    };
+}
@@ -4,27 +4,23 @@
 #include "CellOfMatrix.hpp"
 #include "ViewOfMatrix.hpp"
 #include "Auxiliry.hpp"
+#include "MatrixKernels.hpp"
+#include "MatrixExpression.hpp"
 
 #include <ranges>
 #include <algorithm>
 #include <stdexcept>
 #include <span>
 #include <functional>
+#include <bit>
+#include <limits>
+#include <utility>
 
 
 namespace GameEngine::Geometry::Matrices
 {
-    template<typename T>
-    concept arithmetic_like = requires (T)
-    {
-        std::declval<T const&>() + std::declval<T const&>();
-        std::declval<T const&>() - std::declval<T const&>();
-        std::declval<T const&>() * std::declval<T const&>();
-        std::declval<T const&>() / std::declval<T const&>();
-        std::declval<T&>() = std::declval<T const&>();
-        std::declval<T const&>() == std::declval<T const&>();
-        std::declval<T const&>() != std::declval<T const&>();
-    } && std::is_default_constructible_v<T> == true;
+    using Geometry::arithmetic_like;
+
     static_assert(arithmetic_like<double>);
     static_assert(arithmetic_like<float>);
     static_assert(arithmetic_like<int>);
@@ -47,6 +43,8 @@ namespace GameEngine::Geometry::Matrices
         static_assert(std::is_move_assignable_v<T>    == std::is_nothrow_move_assignable_v<T>);
         static_assert(std::is_move_constructible_v<T> == std::is_nothrow_move_constructible_v<T>);
 
+        using value_type = T;
+
         static constexpr std::size_t NUMBER_OF_ROWS{ M };
         static constexpr std::size_t NUMBER_OF_COLS{ N };
 
@@ -55,11 +53,11 @@ namespace GameEngine::Geometry::Matrices
         class const_iterator;
         constexpr const_iterator begin() const noexcept
         {
-            return const_iterator{ std::to_address(data.begin()), std::to_address(data.begin()) };
+            return const_iterator{ std::to_address(data.begin()), 0U, 0U };
         }
         constexpr const_iterator end()   const noexcept
         {
-            return const_iterator{ std::to_address(data.end()), std::to_address(data.begin()) };
+            return const_iterator{ std::to_address(data.end()), NUMBER_OF_ROWS, 0U };
         }
 
         class const_iterator final
@@ -76,11 +74,10 @@ namespace GameEngine::Geometry::Matrices
 
         private:
 
-            friend constexpr const_iterator Matrix::begin() const noexcept;
-            friend constexpr const_iterator Matrix::end()   const noexcept;
-            const_iterator(T const* init_data, T const* base) noexcept
+            friend class Matrix;
+            constexpr const_iterator(T const* init_data, std::size_t init_row, std::size_t init_col) noexcept
             :
-            data{ init_data, (init_data - base) / N, (init_data - base) % N }
+            data{ init_data, init_row, init_col }
             { }
 
         public:
@@ -130,22 +127,50 @@ namespace GameEngine::Geometry::Matrices
                 return (*this += -delta);
             }
 
+            // Neighbour cells are reached without division
             constexpr const_iterator& operator++()    noexcept
             {
-                return (*this += static_cast<difference_type>(1));
+                if (data.get_col_index() + 1U == N)
+                {
+                    data.set_row_index(data.get_row_index() + 1U);
+                    data.set_col_index(0U);
+                }
+                else
+                {
+                    data.set_col_index(data.get_col_index() + 1U);
+                }
+                data.move_pointer(1);
+
+                return *this;
             }
             constexpr const_iterator  operator++(int) noexcept
             {
-                return std::exchange(*this, *this + static_cast<difference_type>(1));
+                const_iterator const tmp{ *this };
+                ++*this;
+                return tmp;
             }
 
             constexpr const_iterator& operator--()    noexcept
             {
-                return (*this -= static_cast<difference_type>(1));
+                if (data.get_col_index() == 0U)
+                {
+                    assert(("Iterator exceeds matrix's rows during decreasing", data.get_row_index() != 0U));
+                    data.set_row_index(data.get_row_index() - 1U);
+                    data.set_col_index(N - 1U);
+                }
+                else
+                {
+                    data.set_col_index(data.get_col_index() - 1U);
+                }
+                data.move_pointer(-1);
+
+                return *this;
             }
             constexpr const_iterator  operator--(int) noexcept
             {
-                return std::exchange(*this, *this - static_cast<difference_type>(1));
+                const_iterator const tmp{ *this };
+                --*this;
+                return tmp;
             }
 
             friend constexpr const_iterator operator+(const_iterator const& lhs, difference_type rhs) noexcept
@@ -185,7 +210,7 @@ namespace GameEngine::Geometry::Matrices
             }
             friend constexpr bool operator> (const_iterator const& lhs, const_iterator const& rhs) noexcept
             {
-                return (lhs < rhs) && lhs != rhs;
+                return rhs < lhs;
             }
             friend constexpr bool operator<=(const_iterator const& lhs, const_iterator const& rhs) noexcept
             {
@@ -240,6 +265,31 @@ namespace GameEngine::Geometry::Matrices
         constexpr ~Matrix() = default;
 
 
+        // Lazy expression is evaluated in single loop over all elements
+        template<matrix_expression_node E>
+        requires (same_shape_expressions<Matrix, E>)
+        constexpr Matrix(E const& expr) noexcept(noexcept(expr.get_element(0U)) && std::is_nothrow_assignable_v<T&, T>)
+        {
+            for (std::size_t i{ 0U }; i != NUMBER_OF_ROWS * NUMBER_OF_COLS; ++i)
+            {
+                data[i] = expr.get_element(i);
+            }
+        }
+
+        // Element-wise expression reads only element with the same index, so matrix may be its own operand
+        template<matrix_expression_node E>
+        requires (same_shape_expressions<Matrix, E>)
+        constexpr Matrix& operator=(E const& expr) noexcept(noexcept(expr.get_element(0U)) && std::is_nothrow_assignable_v<T&, T>)
+        {
+            for (std::size_t i{ 0U }; i != NUMBER_OF_ROWS * NUMBER_OF_COLS; ++i)
+            {
+                data[i] = expr.get_element(i);
+            }
+
+            return *this;
+        }
+
+
         template<std::ranges::input_range R>
         requires std::same_as<std::ranges::range_value_t<R>, T>
         Matrix (R&& init_data)
@@ -257,11 +307,31 @@ namespace GameEngine::Geometry::Matrices
             return std::span<T const, N>{ beg, beg + NUMBER_OF_COLS };
         }
 
-        std::span<T const, M* N> flattern() const noexcept
+        constexpr std::span<T const, M* N> flattern() const noexcept
+        {
+            return data;
+        }
+
+        // Contiguous range of values in row-major order: the fastest way to visit every element
+        // when indices are not needed. Cells from begin()/end() carry indices and allow random jumps
+        constexpr std::span<T const, M* N> get_values() const noexcept
         {
             return data;
         }
 
+        // Calls f(row, col, value) for every element in row-major order, indices are advanced by increment
+        template<typename F>
+        requires (std::invocable<F&, std::size_t, std::size_t, T const&>)
+        constexpr void for_each_cell(F&& f) const noexcept(std::is_nothrow_invocable_v<F&, std::size_t, std::size_t, T const&>)
+        {
+            T const* value{ data.data() };
+            for (std::size_t i{ 0U }; i != NUMBER_OF_ROWS; ++i)
+            for (std::size_t j{ 0U }; j != NUMBER_OF_COLS; ++j, ++value)
+            {
+                f(i, j, *value);
+            }
+        }
+
         void swap_rows(std::size_t lhs, std::size_t rhs) noexcept
         {
             assert(("Requested row's index must be lesser than number of matrix rows", lhs < NUMBER_OF_ROWS));
@@ -286,15 +356,26 @@ namespace GameEngine::Geometry::Matrices
             }
         }
 
-        constexpr auto get_row(std::size_t i) const noexcept
+        constexpr ViewOfMatrix<N, T> get_row(std::size_t i) const noexcept
         {
             assert(("Requested row's index must not exceed the number of matrix's rows", i < M));
-            return get_row_impl(i, std::make_index_sequence<NUMBER_OF_COLS>{});
+            return ViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, data.data() + i * NUMBER_OF_COLS, 1 };
         }   
-        constexpr auto get_col(std::size_t i) const noexcept
+        constexpr ViewOfMatrix<M, T> get_col(std::size_t i) const noexcept
+        {
+            assert(("Requested column's index must not exceed the number of matrix's columns", i < N));
+            return ViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, i, data.data() + i, static_cast<std::ptrdiff_t>(NUMBER_OF_COLS) };
+        }
+
+        constexpr MutableViewOfMatrix<N, T> get_mutable_row(std::size_t i) noexcept
+        {
+            assert(("Requested row's index must not exceed the number of matrix's rows", i < M));
+            return MutableViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, data.data() + i * NUMBER_OF_COLS, 1 };
+        }
+        constexpr MutableViewOfMatrix<M, T> get_mutable_col(std::size_t i) noexcept
         {
             assert(("Requested column's index must not exceed the number of matrix's columns", i < N));
-            return get_col_impl(i, std::make_index_sequence<NUMBER_OF_ROWS>{});
+            return MutableViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, i, data.data() + i, static_cast<std::ptrdiff_t>(NUMBER_OF_COLS) };
         }
 
         constexpr Matrix<N, M, T> get_transponsed() const noexcept(std::is_nothrow_assignable_v<T, T>)
@@ -358,20 +439,6 @@ namespace GameEngine::Geometry::Matrices
             return *this;
         }
 
-    private:
-
-        template<std::size_t... Indices>
-        constexpr auto get_row_impl(std::size_t i, std::index_sequence<Indices...>) const noexcept
-        {
-            return ViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, &data[i * NUMBER_OF_COLS + Indices]... };
-        }
-
-        template<std::size_t... Indices>
-        constexpr auto get_col_impl(std::size_t i, std::index_sequence<Indices...>) const noexcept
-        {
-            return ViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, i, &data[i + Indices * NUMBER_OF_COLS]... };
-        }
-
     public:
 
         friend constexpr bool operator==(Matrix const& lhs, Matrix const& rhs) noexcept
@@ -398,44 +465,6 @@ namespace GameEngine::Geometry::Matrices
             return !(lhs == rhs);
         }
 
-        friend constexpr Matrix operator+(Matrix const& lhs, Matrix const& rhs) noexcept(noexcept(std::declval<T const&>() + std::declval<T const&>()))
-        {
-            std::array<T, M * N> sum_result{ };
-
-            std::ranges::transform(lhs.data, rhs.data, sum_result.begin(), std::plus<T>{});
-
-            return Matrix{ std::move(sum_result) };
-        }
-        friend constexpr Matrix operator-(Matrix const& lhs, Matrix const& rhs) noexcept(noexcept(std::declval<T const&>() - std::declval<T const&>()))
-        {
-            std::array<T, M* N> sub_result{ };
-
-            std::ranges::transform(lhs.data, rhs.data, sub_result.begin(), std::minus<T>{});
-
-            return Matrix{ std::move(sub_result) };
-        }
-        friend constexpr Matrix operator*(Matrix const& lhs, T const& rhs) noexcept(noexcept(std::declval<T const&>() * std::declval<T const&>()))
-        {
-            std::array<T, M * N> mul_result{ };
-
-            std::ranges::transform(lhs.data, mul_result.begin(), [&rhs](auto const& val) noexcept { return rhs * val; });
-
-            return Matrix{ std::move(mul_result) };
-        }
-        friend constexpr Matrix operator*(T const& lhs, Matrix const& rhs) noexcept(noexcept(std::declval<T const&>() * std::declval<T const&>()))
-        {
-            return rhs * lhs;
-        }
-        friend constexpr Matrix operator/(Matrix const& lhs, T const& rhs) noexcept(noexcept(std::declval<T const&>() / std::declval<T const&>()))
-        {
-            std::array<T, M* N> mul_result{ };
-
-            std::ranges::transform(lhs.data, mul_result.begin(), [&rhs](auto const& val) noexcept { return val / rhs; });
-
-            return Matrix{ std::move(mul_result) };
-        }
-
-
         Matrix& operator+=(Matrix const& rhs) noexcept(noexcept(std::declval<T const&>() + std::declval<T const&>()))
         {
             std::ranges::transform(data, rhs.data, data.begin(), std::plus<T>{});
@@ -481,8 +510,9 @@ namespace GameEngine::Geometry::Matrices
         return true;
     }
 
+    // Reference implementation of the product, also used as fallback for sizes without vectorized kernel
     template<std::size_t M, std::size_t N, std::size_t K, typename T>
-    Matrix<M, K, T> operator*(Matrix<M, N, T> const& lhs, Matrix<N, K, T> const& rhs) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()))
+    Matrix<M, K, T> multiply_generic(Matrix<M, N, T> const& lhs, Matrix<N, K, T> const& rhs) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()))
     {
         std::array<T, M* K> mul_result{ };
 
@@ -497,8 +527,46 @@ namespace GameEngine::Geometry::Matrices
         return Matrix<M, K, T>{ std::move(mul_result) };
     }
 
-    template<std::size_t S, typename T>
-    auto get_vector_row(ViewOfMatrix<S, T> const& init_data) noexcept
+    template<std::size_t M, std::size_t N, std::size_t K, typename T>
+    Matrix<M, K, T> operator*(Matrix<M, N, T> const& lhs, Matrix<N, K, T> const& rhs) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()))
+    {
+        if constexpr (Kernels::has_simd_multiply<M, N, K, T>)
+        {
+            std::array<T, M * K> mul_result;
+
+            Kernels::multiply<M, N, K>(lhs.flattern().data(), rhs.flattern().data(), mul_result.data());
+
+            return Matrix<M, K, T>{ std::move(mul_result) };
+        }
+        else
+        {
+            return multiply_generic(lhs, rhs);
+        }
+    }
+
+    template<matrix_expression_node E>
+    constexpr auto evaluate(E const& expr) noexcept(noexcept(expr.get_element(0U)))
+    {
+        return Matrix<E::NUMBER_OF_ROWS, E::NUMBER_OF_COLS, typename E::value_type>{ expr };
+    }
+
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr Matrix<M, N, T> const& evaluate(Matrix<M, N, T> const& m) noexcept
+    {
+        return m;
+    }
+
+    // Product is not element-wise, so lazy operands are evaluated before multiplication
+    template<typename L, typename R>
+    requires (matrix_expression<L> && matrix_expression<R> && (element_wise_expression_node<L> || element_wise_expression_node<R>) &&
+              L::NUMBER_OF_COLS == R::NUMBER_OF_ROWS && std::same_as<typename L::value_type, typename R::value_type>)
+    auto operator*(L const& lhs, R const& rhs)
+    {
+        return evaluate(lhs) * evaluate(rhs);
+    }
+
+    template<std::size_t S, typename T, bool IS_MUTABLE>
+    auto get_vector_row(ViewOfMatrix<S, T, IS_MUTABLE> const& init_data) noexcept
     {
         std::array<T, S> tmp{ };
         
@@ -507,8 +575,8 @@ namespace GameEngine::Geometry::Matrices
         return Matrix<1U, S, T>{ std::move(tmp) };
     }
 
-    template<std::size_t S, typename T>
-    auto get_vector_col(ViewOfMatrix<S, T> const& init_data) noexcept
+    template<std::size_t S, typename T, bool IS_MUTABLE>
+    auto get_vector_col(ViewOfMatrix<S, T, IS_MUTABLE> const& init_data) noexcept
     {
         std::array<T, S> tmp{ };
 
@@ -588,7 +656,7 @@ namespace GameEngine::Geometry::Matrices
     }
 
     template<std::size_t M, typename T>
-    requires (!std::floating_point<T>)
+    requires (!std::floating_point<T> && !std::signed_integral<T>)
     T get_determinant(Matrix<M, M, T> m)
     {
         static constexpr T ZERO{ 0 };
@@ -626,9 +694,10 @@ namespace GameEngine::Geometry::Matrices
         return D;
     }
 
+    // Gaussian elimination for any size, used by get_determinant for sizes without closed form
     template<std::size_t M, typename T>
     requires (std::floating_point<T>)
-    T get_determinant(Matrix<M, M, T> m)
+    T get_determinant_generic(Matrix<M, M, T> m)
     {
         static constexpr T ZERO { 0 };
         static constexpr T ONE  { 1 };
@@ -666,7 +735,7 @@ namespace GameEngine::Geometry::Matrices
     }
 
     template<std::size_t M, typename T>
-    requires (!std::floating_point<T>)
+    requires (!std::floating_point<T> && !std::signed_integral<T>)
     Matrix<M, M, T> get_inversed(Matrix<M, M, T> const& m)
     {
         static constexpr T ZERO{ 0 };
@@ -709,9 +778,10 @@ namespace GameEngine::Geometry::Matrices
         return get_from<0U, M, M - 1U, M + M - 1U>(expanded);
     }
 
+    // Gauss-Jordan elimination for any size, used by get_inversed for sizes without closed form
     template<std::size_t M, typename T>
     requires (std::floating_point<T>)
-    Matrix<M, M, T> get_inversed(Matrix<M, M, T> const& m)
+    Matrix<M, M, T> get_inversed_generic(Matrix<M, M, T> const& m)
     {
         static constexpr T ZERO{ 0 };
         static constexpr T ONE{ 1 };
@@ -726,7 +796,7 @@ namespace GameEngine::Geometry::Matrices
                 std::size_t i{ };
                 for (i = I + 1U; i != m.NUMBER_OF_ROWS; ++i)
                 {
-                    if (Auxiliry::is_equal_with_precision(expanded[i][I], ZERO)) break;
+                    if (!Auxiliry::is_equal_with_precision(expanded[i][I], ZERO)) break;
                 }
 
                 if (i == expanded.NUMBER_OF_ROWS) throw std::runtime_error{ "Matrix is singular" };
@@ -753,6 +823,446 @@ namespace GameEngine::Geometry::Matrices
         return get_from<0U, M, M - 1U, M + M - 1U>(expanded);
     }
 
+    // Adjugate (cofactor) formulas for small matrices, they need neither pivoting nor temporary augmented matrix
+    namespace ClosedForm
+    {
+        template<std::size_t M>
+        inline constexpr bool is_supported{ M >= 2U && M <= 4U };
+
+        // A is any row-major sequence of M * M values indexed by operator[]: span of matrix or lane of batch
+        template<std::size_t M, typename T, typename A>
+        requires (is_supported<M>)
+        constexpr T get_determinant(A const& a) noexcept
+        {
+            if constexpr (M == 2U)
+            {
+                return a[0] * a[3] - a[1] * a[2];
+            }
+            else if constexpr (M == 3U)
+            {
+                return a[0] * (a[4] * a[8] - a[5] * a[7])
+                     - a[1] * (a[3] * a[8] - a[5] * a[6])
+                     + a[2] * (a[3] * a[7] - a[4] * a[6]);
+            }
+            else
+            {
+                // 2x2 minors of two top rows and two bottom rows (Laplace expansion)
+                T const s0{ a[0] * a[5]  - a[4]  * a[1] };
+                T const s1{ a[0] * a[6]  - a[4]  * a[2] };
+                T const s2{ a[0] * a[7]  - a[4]  * a[3] };
+                T const s3{ a[1] * a[6]  - a[5]  * a[2] };
+                T const s4{ a[1] * a[7]  - a[5]  * a[3] };
+                T const s5{ a[2] * a[7]  - a[6]  * a[3] };
+
+                T const c0{ a[8]  * a[13] - a[12] * a[9]  };
+                T const c1{ a[8]  * a[14] - a[12] * a[10] };
+                T const c2{ a[8]  * a[15] - a[12] * a[11] };
+                T const c3{ a[9]  * a[14] - a[13] * a[10] };
+                T const c4{ a[9]  * a[15] - a[13] * a[11] };
+                T const c5{ a[10] * a[15] - a[14] * a[11] };
+
+                return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            }
+        }
+
+        // Returns adjugate matrix and determinant
+        template<std::size_t M, typename T, typename A>
+        requires (is_supported<M>)
+        constexpr std::pair<std::array<T, M * M>, T> get_adjugate(A const& a) noexcept
+        {
+            if constexpr (M == 2U)
+            {
+                return { { a[3], -a[1], -a[2], a[0] }, a[0] * a[3] - a[1] * a[2] };
+            }
+            else if constexpr (M == 3U)
+            {
+                T const c00{ a[4] * a[8] - a[5] * a[7] };
+                T const c01{ a[5] * a[6] - a[3] * a[8] };
+                T const c02{ a[3] * a[7] - a[4] * a[6] };
+
+                return
+                {
+                    {
+                        c00, a[2] * a[7] - a[1] * a[8], a[1] * a[5] - a[2] * a[4],
+                        c01, a[0] * a[8] - a[2] * a[6], a[2] * a[3] - a[0] * a[5],
+                        c02, a[1] * a[6] - a[0] * a[7], a[0] * a[4] - a[1] * a[3]
+                    },
+                    a[0] * c00 + a[1] * c01 + a[2] * c02
+                };
+            }
+            else
+            {
+                T const s0{ a[0] * a[5]  - a[4]  * a[1] };
+                T const s1{ a[0] * a[6]  - a[4]  * a[2] };
+                T const s2{ a[0] * a[7]  - a[4]  * a[3] };
+                T const s3{ a[1] * a[6]  - a[5]  * a[2] };
+                T const s4{ a[1] * a[7]  - a[5]  * a[3] };
+                T const s5{ a[2] * a[7]  - a[6]  * a[3] };
+
+                T const c0{ a[8]  * a[13] - a[12] * a[9]  };
+                T const c1{ a[8]  * a[14] - a[12] * a[10] };
+                T const c2{ a[8]  * a[15] - a[12] * a[11] };
+                T const c3{ a[9]  * a[14] - a[13] * a[10] };
+                T const c4{ a[9]  * a[15] - a[13] * a[11] };
+                T const c5{ a[10] * a[15] - a[14] * a[11] };
+
+                return
+                {
+                    {
+                         a[5]  * c5 - a[6]  * c4 + a[7]  * c3,
+                        -a[1]  * c5 + a[2]  * c4 - a[3]  * c3,
+                         a[13] * s5 - a[14] * s4 + a[15] * s3,
+                        -a[9]  * s5 + a[10] * s4 - a[11] * s3,
+
+                        -a[4]  * c5 + a[6]  * c2 - a[7]  * c1,
+                         a[0]  * c5 - a[2]  * c2 + a[3]  * c1,
+                        -a[12] * s5 + a[14] * s2 - a[15] * s1,
+                         a[8]  * s5 - a[10] * s2 + a[11] * s1,
+
+                         a[4]  * c4 - a[5]  * c2 + a[7]  * c0,
+                        -a[0]  * c4 + a[1]  * c2 - a[3]  * c0,
+                         a[12] * s4 - a[13] * s2 + a[15] * s0,
+                        -a[8]  * s4 + a[9]  * s2 - a[11] * s0,
+
+                        -a[4]  * c3 + a[5]  * c1 - a[6]  * c0,
+                         a[0]  * c3 - a[1]  * c1 + a[2]  * c0,
+                        -a[12] * s3 + a[13] * s1 - a[14] * s0,
+                         a[8]  * s3 - a[9]  * s1 + a[10] * s0
+                    },
+                    s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0
+                };
+            }
+        }
+    }
+
+    template<std::size_t M, typename T>
+    requires (std::floating_point<T>)
+    constexpr T get_determinant(Matrix<M, M, T> const& m)
+    {
+        if constexpr (ClosedForm::is_supported<M>)
+        {
+            return ClosedForm::get_determinant<M, T>(m.flattern());
+        }
+        else
+        {
+            return get_determinant_generic(m);
+        }
+    }
+
+    template<std::size_t M, typename T>
+    requires (std::floating_point<T>)
+    constexpr Matrix<M, M, T> get_inversed(Matrix<M, M, T> const& m)
+    {
+        if constexpr (ClosedForm::is_supported<M>)
+        {
+            auto [adj, D] { ClosedForm::get_adjugate<M, T>(m.flattern()) };
+
+            // Only exact zero is singular: determinant scales as the M-th power of elements, so any absolute threshold
+            // would reject well-conditioned matrices of small elements
+            if (D == T{ 0 }) throw std::runtime_error{ "Matrix is singular" };
+
+            T const inv_D{ T{ 1 } / D };
+            for (auto& el : adj)
+            {
+                el = el * inv_D;
+            }
+
+            return Matrix<M, M, T>{ std::move(adj) };
+        }
+        else
+        {
+            return get_inversed_generic(m);
+        }
+    }
+
+    namespace Bareiss
+    {
+        // Division by value which is known to divide numerator exactly: multiplication by inverse of its odd part
+        // modulo 2^n after shifting out its power of two. Much cheaper than integer division.
+        // For odd divisor the low n bits of numerator are enough, so the result is correct even if numerator has wrapped around,
+        // as long as the quotient itself fits in T. Even divisor shifts high bits of numerator into the quotient,
+        // so then numerator is computed in two words and nothing is lost by the wrap
+        template<std::signed_integral T>
+        class ExactDivisor final
+        {
+        public:
+
+            using unsigned_type = std::make_unsigned_t<std::common_type_t<T, int>>;
+            using signed_type   = std::make_signed_t<unsigned_type>;
+
+        public:
+
+            constexpr explicit ExactDivisor(T divisor) noexcept
+            :
+            shift{ std::countr_zero(static_cast<unsigned_type>(divisor)) }
+            {
+                assert(("Divisor must not be zero", divisor != T{ 0 }));
+
+                // Arithmetic shift keeps the sign, so odd part is exact modulo 2^n
+                unsigned_type const odd{ static_cast<unsigned_type>(static_cast<signed_type>(divisor) >> shift) };
+
+                // Newton's iteration doubles the number of correct low bits, odd * odd == 1 (mod 8)
+                inverse = odd;
+                for (int bits{ 3 }; bits < std::numeric_limits<unsigned_type>::digits; bits *= 2)
+                {
+                    inverse = static_cast<unsigned_type>(inverse * (unsigned_type{ 2U } - odd * inverse));
+                }
+            }
+
+            // (a * d - b * c) / divisor
+            constexpr T get_quotient(T a, T d, T b, T c) const noexcept
+            {
+                if (shift == 0)
+                {
+                    unsigned_type const numerator{ static_cast<unsigned_type>(static_cast<unsigned_type>(a) * static_cast<unsigned_type>(d) - static_cast<unsigned_type>(b) * static_cast<unsigned_type>(c)) };
+                    return static_cast<T>(static_cast<signed_type>(static_cast<unsigned_type>(numerator * inverse)));
+                }
+
+                WideValue const ad{ get_wide_product(a, d) };
+                WideValue const bc{ get_wide_product(b, c) };
+                unsigned_type const low{ static_cast<unsigned_type>(ad.low - bc.low) };
+                unsigned_type const high{ static_cast<unsigned_type>(ad.high - bc.high - (ad.low < bc.low ? 1U : 0U)) };
+
+                unsigned_type const shifted{ static_cast<unsigned_type>((low >> shift) | (high << (std::numeric_limits<unsigned_type>::digits - shift))) };
+                return static_cast<T>(static_cast<signed_type>(static_cast<unsigned_type>(shifted * inverse)));
+            }
+
+        private:
+
+            // 2n-bit two's complement value as two n-bit words
+            struct WideValue final
+            {
+                unsigned_type high;
+                unsigned_type low;
+            };
+
+            // Full product from four products of half words
+            static constexpr WideValue get_wide_product(T lhs, T rhs) noexcept
+            {
+                constexpr int HALF{ std::numeric_limits<unsigned_type>::digits / 2 };
+                constexpr unsigned_type MASK{ static_cast<unsigned_type>((unsigned_type{ 1U } << HALF) - 1U) };
+
+                unsigned_type const x{ static_cast<unsigned_type>(lhs) };
+                unsigned_type const y{ static_cast<unsigned_type>(rhs) };
+
+                unsigned_type const p00{ static_cast<unsigned_type>((x & MASK) * (y & MASK)) };
+                unsigned_type const p01{ static_cast<unsigned_type>((x & MASK) * (y >> HALF)) };
+                unsigned_type const p10{ static_cast<unsigned_type>((x >> HALF) * (y & MASK)) };
+                unsigned_type const p11{ static_cast<unsigned_type>((x >> HALF) * (y >> HALF)) };
+
+                unsigned_type const middle{ static_cast<unsigned_type>((p00 >> HALF) + (p01 & MASK) + (p10 & MASK)) };
+                unsigned_type high{ static_cast<unsigned_type>(p11 + (p01 >> HALF) + (p10 >> HALF) + (middle >> HALF)) };
+
+                // Unsigned product of negative value is larger than the signed one by the other factor * 2^n
+                if (lhs < T{ 0 }) high = static_cast<unsigned_type>(high - y);
+                if (rhs < T{ 0 }) high = static_cast<unsigned_type>(high - x);
+
+                return WideValue{ high, static_cast<unsigned_type>((middle << HALF) | (p00 & MASK)) };
+            }
+
+        private:
+
+            int shift;
+            unsigned_type inverse{ };
+        };
+
+        // One step of fraction-free elimination: (a * d - b * c) / prev, division is always exact
+        template<std::signed_integral T>
+        constexpr T get_next_value(T a, T d, T b, T c, ExactDivisor<T> const& prev) noexcept
+        {
+            return prev.get_quotient(a, d, b, c);
+        }
+
+        template<std::signed_integral T>
+        constexpr T get_next_value(T a, T d, T b, T c, T prev)
+        {
+            return Auxiliry::get_checked_quotient(Auxiliry::get_checked_difference(Auxiliry::get_checked_product(a, d), Auxiliry::get_checked_product(b, c)), prev);
+        }
+
+        template<bool IS_CHECKED, std::signed_integral T>
+        using divisor_t = std::conditional_t<IS_CHECKED, T, ExactDivisor<T>>;
+
+        template<bool IS_CHECKED, std::size_t M, std::signed_integral T>
+        constexpr T get_determinant(Matrix<M, M, T> const& m)
+        {
+            constexpr T ZERO{ 0 };
+            constexpr T ONE{ 1 };
+
+            std::array<T, M * M> a{ };
+            std::ranges::copy(m.flattern(), a.begin());
+
+            divisor_t<IS_CHECKED, T> prev{ ONE };
+            bool odd_permutation{ false };
+
+            for (std::size_t I{ 0U }; I != M - 1U; ++I)
+            {
+                if (a[I * M + I] == ZERO)
+                {
+                    std::size_t i{ };
+                    for (i = I + 1U; i != M; ++i)
+                    {
+                        if (a[i * M + I] != ZERO) break;
+                    }
+
+                    if (i == M) return ZERO;
+
+                    std::swap_ranges(a.begin() + I * M, a.begin() + (I + 1U) * M, a.begin() + i * M);
+                    odd_permutation = !odd_permutation;
+                }
+
+                for (std::size_t i{ I + 1U }; i != M; ++i)
+                for (std::size_t j{ I + 1U }; j != M; ++j)
+                {
+                    a[i * M + j] = get_next_value(a[i * M + j], a[I * M + I], a[i * M + I], a[I * M + j], prev);
+                }
+
+                prev = divisor_t<IS_CHECKED, T>{ a[I * M + I] };
+            }
+
+            T const D{ a[M * M - 1U] };
+            if constexpr (IS_CHECKED)
+            {
+                return odd_permutation ? Auxiliry::get_checked_difference(ZERO, D) : D;
+            }
+            else
+            {
+                return odd_permutation ? static_cast<T>(-D) : D;
+            }
+        }
+
+        // Fraction-free Gauss-Jordan elimination of [A | I]. Result is s * [det(A) * I | adj(A)],
+        // where s is -1 when odd number of rows were swapped
+        template<bool IS_CHECKED, std::size_t M, std::signed_integral T>
+        constexpr Matrix<M, M + M, T> get_reduced(Matrix<M, M, T> const& m, bool& odd_permutation)
+        {
+            constexpr T ZERO{ 0 };
+            constexpr T ONE{ 1 };
+            constexpr std::size_t N{ M + M };
+
+            std::array<T, M * N> a{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                for (std::size_t j{ 0U }; j != M; ++j)
+                {
+                    a[i * N + j] = m.flattern()[i * M + j];
+                }
+                a[i * N + M + i] = ONE;
+            }
+
+            divisor_t<IS_CHECKED, T> prev{ ONE };
+
+            for (std::size_t I{ 0U }; I != M; ++I)
+            {
+                if (a[I * N + I] == ZERO)
+                {
+                    std::size_t i{ };
+                    for (i = I + 1U; i != M; ++i)
+                    {
+                        if (a[i * N + I] != ZERO) break;
+                    }
+
+                    if (i == M) throw std::runtime_error{ "Matrix is singular" };
+
+                    std::swap_ranges(a.begin() + I * N, a.begin() + (I + 1U) * N, a.begin() + i * N);
+                    odd_permutation = !odd_permutation;
+                }
+
+                for (std::size_t i{ 0U }; i != M; ++i)
+                {
+                    if (i == I) continue;
+
+                    for (std::size_t j{ 0U }; j != N; ++j)
+                    {
+                        if (j == I) continue;
+
+                        a[i * N + j] = get_next_value(a[i * N + j], a[I * N + I], a[i * N + I], a[I * N + j], prev);
+                    }
+                    a[i * N + I] = ZERO;
+                }
+
+                prev = divisor_t<IS_CHECKED, T>{ a[I * N + I] };
+            }
+
+            return Matrix<M, N, T>{ std::move(a) };
+        }
+
+        template<bool IS_CHECKED, std::size_t M, std::signed_integral T>
+        constexpr Matrix<M, M, T> get_inversed(Matrix<M, M, T> const& m)
+        {
+            constexpr T ZERO{ 0 };
+            constexpr std::size_t N{ M + M };
+
+            bool odd_permutation{ false };
+            auto const reduced{ get_reduced<IS_CHECKED>(m, odd_permutation) };
+            auto const r_data{ reduced.flattern() };
+
+            // Sign doesn't matter here: both adjugate and determinant parts are multiplied by it
+            T const D{ r_data[0U] };
+
+            std::array<T, M * M> inv{ };
+            for (std::size_t i{ 0U }; i != M; ++i)
+            for (std::size_t j{ 0U }; j != M; ++j)
+            {
+                T const adj{ r_data[i * N + M + j] };
+                if (adj % D != ZERO) throw std::runtime_error{ "Inverse matrix is not integral" };
+
+                inv[i * M + j] = static_cast<T>(adj / D);
+            }
+
+            return Matrix<M, M, T>{ std::move(inv) };
+        }
+    }
+
+    // Exact determinant of integral matrix computed by Bareiss algorithm without leaving integer arithmetic.
+    // Intermediate values are minors of the matrix, so they stay bounded by Hadamard's bound.
+    template<std::size_t M, std::signed_integral T>
+    constexpr T get_determinant(Matrix<M, M, T> const& m) noexcept
+    {
+        return Bareiss::get_determinant<false>(m);
+    }
+
+    // Same as get_determinant, but throws std::overflow_error instead of silent overflow of intermediate values
+    template<std::size_t M, std::signed_integral T>
+    constexpr T get_determinant_checked(Matrix<M, M, T> const& m)
+    {
+        return Bareiss::get_determinant<true>(m);
+    }
+
+    // Adjugate is integral for any integral matrix
+    template<std::size_t M, std::signed_integral T>
+    constexpr Matrix<M, M, T> get_adjugate(Matrix<M, M, T> const& m)
+    {
+        constexpr std::size_t N{ M + M };
+
+        bool odd_permutation{ false };
+        auto const reduced{ Bareiss::get_reduced<false>(m, odd_permutation) };
+        auto const r_data{ reduced.flattern() };
+
+        T const sign{ static_cast<T>(odd_permutation ? -1 : 1) };
+
+        std::array<T, M * M> adj{ };
+        for (std::size_t i{ 0U }; i != M; ++i)
+        for (std::size_t j{ 0U }; j != M; ++j)
+        {
+            adj[i * M + j] = static_cast<T>(sign * r_data[i * N + M + j]);
+        }
+
+        return Matrix<M, M, T>{ std::move(adj) };
+    }
+
+    // Exact inverse of integral matrix. Throws std::runtime_error if matrix is singular or inverse has fractional elements
+    template<std::size_t M, std::signed_integral T>
+    constexpr Matrix<M, M, T> get_inversed(Matrix<M, M, T> const& m)
+    {
+        return Bareiss::get_inversed<false>(m);
+    }
+
+    template<std::size_t M, std::signed_integral T>
+    constexpr Matrix<M, M, T> get_inversed_checked(Matrix<M, M, T> const& m)
+    {
+        return Bareiss::get_inversed<true>(m);
+    }
+
     template<std::size_t M, std::size_t N, typename T>
     Matrix<M - 1U, N, T> remove_row(Matrix<M, N, T> const& m, std::size_t I) noexcept(std::is_nothrow_assignable_v<T, T>)
     {
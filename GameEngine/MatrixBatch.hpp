@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    namespace Batch
+    {
+        inline constexpr std::size_t CACHE_LINE_SIZE{ 64U };
+
+        // Lanes are stored inside of batch, so it lives on stack as local variable. Operation keeps operands and result
+        // alive at once, so one batch takes at most 1/8 of 1 MiB stack of a thread by default (MSVC).
+        // Bigger sets of matrices are split into several batches
+        inline constexpr std::size_t MAX_STORAGE_SIZE{ 128U * 1024U };
+
+        // Distance between lanes of two neighbour elements. Rows of lanes are padded to odd number of cache lines:
+        // with stride of 4 KiB (1024 floats) all elements map to the same cache set and evict each other
+        template<typename T>
+        consteval std::size_t get_lane_stride(std::size_t K) noexcept
+        {
+            if (K * sizeof(T) <= CACHE_LINE_SIZE || CACHE_LINE_SIZE % sizeof(T) != 0U) return K;
+
+            constexpr std::size_t PER_LINE{ CACHE_LINE_SIZE / sizeof(T) };
+
+            std::size_t lines{ (K + PER_LINE - 1U) / PER_LINE };
+            if (lines % 2U == 0U) ++lines;
+
+            return lines * PER_LINE;
+        }
+
+        // Matrix k of batch seen as row-major sequence of its elements. Formulas written for one matrix
+        // (e.g. ClosedForm) read element e of every matrix from contiguous memory, so loop over k is vectorized
+        template<typename T, std::size_t STRIDE>
+        struct LaneOf final
+        {
+            T const* data{ nullptr };
+            std::size_t k{ 0U };
+
+            constexpr T const& operator[](std::size_t e) const noexcept
+            {
+                return data[e * STRIDE + k];
+            }
+        };
+    }
+
+    // K matrices of the same size stored as structure of arrays: all K values of element (i, j) are contiguous,
+    // so operations run over lanes instead of over elements of one matrix
+    template<std::size_t M, std::size_t N, arithmetic_like T, std::size_t K>
+    requires (M != 0U && N != 0U && K != 0U && M * N * Batch::get_lane_stride<T>(K) * sizeof(T) <= Batch::MAX_STORAGE_SIZE)
+    class MatrixBatch final
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ M };
+        static constexpr std::size_t NUMBER_OF_COLS{ N };
+        static constexpr std::size_t NUMBER_OF_LANES{ K };
+
+        // Lane k of element e is get_data()[e * LANE_STRIDE + k]
+        static constexpr std::size_t LANE_STRIDE{ Batch::get_lane_stride<T>(K) };
+
+    public:
+
+        constexpr MatrixBatch() = default;
+        constexpr explicit MatrixBatch(std::span<Matrix<M, N, T> const, K> ms) noexcept
+        {
+            for (std::size_t k{ 0U }; k != K; ++k)
+            {
+                set_matrix(k, ms[k]);
+            }
+        }
+        constexpr explicit MatrixBatch(std::array<Matrix<M, N, T>, K> const& ms) noexcept
+        :
+        MatrixBatch{ std::span<Matrix<M, N, T> const, K>{ ms } }
+        { }
+
+        constexpr MatrixBatch(MatrixBatch const&) = default;
+        constexpr MatrixBatch(MatrixBatch&&)      = default;
+
+        constexpr MatrixBatch& operator=(MatrixBatch const&) = default;
+        constexpr MatrixBatch& operator=(MatrixBatch&&)      = default;
+
+        constexpr ~MatrixBatch() = default;
+
+
+        constexpr Matrix<M, N, T> get_matrix(std::size_t k) const noexcept
+        {
+            assert(("Requested lane must not exceed the number of matrices in batch", k < K));
+
+            std::array<T, M * N> m{ };
+            for (std::size_t e{ 0U }; e != M * N; ++e)
+            {
+                m[e] = data[e * LANE_STRIDE + k];
+            }
+            return Matrix<M, N, T>{ std::move(m) };
+        }
+
+        constexpr void set_matrix(std::size_t k, Matrix<M, N, T> const& m) noexcept
+        {
+            assert(("Requested lane must not exceed the number of matrices in batch", k < K));
+
+            auto const m_data{ m.flattern() };
+            for (std::size_t e{ 0U }; e != M * N; ++e)
+            {
+                data[e * LANE_STRIDE + k] = m_data[e];
+            }
+        }
+
+        constexpr std::array<Matrix<M, N, T>, K> to_array() const noexcept
+        {
+            std::array<Matrix<M, N, T>, K> res{ };
+            for (std::size_t k{ 0U }; k != K; ++k)
+            {
+                res[k] = get_matrix(k);
+            }
+            return res;
+        }
+
+        // Values of element (i, j) of every matrix
+        constexpr std::span<T const, K> get_lanes(std::size_t i, std::size_t j) const noexcept
+        {
+            assert(("Requested element must be inside of matrix", i < M && j < N));
+            return std::span<T const, K>{ data.data() + (i * N + j) * LANE_STRIDE, K };
+        }
+        constexpr std::span<T, K> get_mutable_lanes(std::size_t i, std::size_t j) noexcept
+        {
+            assert(("Requested element must be inside of matrix", i < M && j < N));
+            return std::span<T, K>{ data.data() + (i * N + j) * LANE_STRIDE, K };
+        }
+
+        constexpr T const* get_data() const noexcept
+        {
+            return data.data();
+        }
+        constexpr T* get_mutable_data() noexcept
+        {
+            return data.data();
+        }
+
+        friend constexpr bool operator==(MatrixBatch const& lhs, MatrixBatch const& rhs) noexcept
+        {
+            for (std::size_t k{ 0U }; k != K; ++k)
+            {
+                if (lhs.get_matrix(k) != rhs.get_matrix(k)) return false;
+            }
+            return true;
+        }
+        friend constexpr bool operator!=(MatrixBatch const& lhs, MatrixBatch const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+
+        alignas(Batch::CACHE_LINE_SIZE) std::array<T, M * N * LANE_STRIDE> data{ };
+    };
+
+    // Every lane k of result is lhs[k] * rhs[k]. Sum over n is unrolled, so each lane of result is written once
+    // and summation order is the same as in product of single matrices
+    template<std::size_t M, std::size_t N, std::size_t P, typename T, std::size_t K>
+    constexpr MatrixBatch<M, P, T, K> operator*(MatrixBatch<M, N, T, K> const& lhs, MatrixBatch<N, P, T, K> const& rhs) noexcept
+    {
+        constexpr std::size_t S{ MatrixBatch<M, N, T, K>::LANE_STRIDE };
+
+        T const* const a{ lhs.get_data() };
+        T const* const b{ rhs.get_data() };
+
+        MatrixBatch<M, P, T, K> res{ };
+        T* const out{ res.get_mutable_data() };
+
+        for (std::size_t i{ 0U }; i != M; ++i)
+        for (std::size_t p{ 0U }; p != P; ++p)
+        {
+            T const* const x{ a + i * N * S };
+            T const* const y{ b + p * S };
+            T*       const z{ out + (i * P + p) * S };
+
+            for (std::size_t k{ 0U }; k != K; ++k)
+            {
+                z[k] = [x, y, k]<std::size_t... Ns>(std::index_sequence<Ns...>) noexcept
+                {
+                    T sum{ };
+                    ((sum = sum + x[Ns * S + k] * y[Ns * P * S + k]), ...);
+                    return sum;
+                }(std::make_index_sequence<N>{ });
+            }
+        }
+
+        return res;
+    }
+
+    // Determinants of all matrices, closed-form formulas are evaluated across lanes
+    template<std::size_t M, typename T, std::size_t K>
+    requires (ClosedForm::is_supported<M>)
+    constexpr std::array<T, K> get_determinant(MatrixBatch<M, M, T, K> const& batch) noexcept
+    {
+        constexpr std::size_t S{ MatrixBatch<M, M, T, K>::LANE_STRIDE };
+
+        std::array<T, K> res{ };
+        for (std::size_t k{ 0U }; k != K; ++k)
+        {
+            res[k] = ClosedForm::get_determinant<M, T>(Batch::LaneOf<T, S>{ batch.get_data(), k });
+        }
+
+        return res;
+    }
+
+    // Inverses of all matrices. Throws std::runtime_error if any of them is singular
+    template<std::size_t M, typename T, std::size_t K>
+    requires (ClosedForm::is_supported<M> && std::floating_point<T>)
+    constexpr MatrixBatch<M, M, T, K> get_inversed(MatrixBatch<M, M, T, K> const& batch)
+    {
+        constexpr std::size_t S{ MatrixBatch<M, M, T, K>::LANE_STRIDE };
+
+        MatrixBatch<M, M, T, K> res{ };
+        T* const out{ res.get_mutable_data() };
+
+        unsigned n_singular{ 0U };
+
+        for (std::size_t k{ 0U }; k != K; ++k)
+        {
+            auto const [adj, D] { ClosedForm::get_adjugate<M, T>(Batch::LaneOf<T, S>{ batch.get_data(), k }) };
+
+            // Same test as get_inversed of Matrix, but without branches and with counter
+            // instead of boolean flag, otherwise the loop is not vectorized
+            n_singular += (D == T{ 0 });
+
+            // Elements are stored with compile-time indices, so adjugate stays in registers
+            T const inv_D{ T{ 1 } / D };
+            [out, &adj, &inv_D, k]<std::size_t... E>(std::index_sequence<E...>) noexcept
+            {
+                ((out[E * S + k] = adj[E] * inv_D), ...);
+            }(std::make_index_sequence<M * M>{ });
+        }
+
+        if (n_singular != 0U) throw std::runtime_error{ "Matrix is singular" };
+
+        return res;
+    }
+}
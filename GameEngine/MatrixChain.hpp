@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <array>
+#include <tuple>
+#include <limits>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    namespace Chain
+    {
+        template<typename T>
+        inline constexpr bool is_matrix_v{ false };
+
+        template<std::size_t M, std::size_t N, typename T>
+        inline constexpr bool is_matrix_v<Matrix<M, N, T>>{ true };
+
+        template<typename... Ms>
+        concept multipliable_chain = sizeof...(Ms) >= 2U && (is_matrix_v<std::remove_cvref_t<Ms>> && ...) &&
+        []() consteval
+        {
+            constexpr std::array rows{ std::remove_cvref_t<Ms>::NUMBER_OF_ROWS... };
+            constexpr std::array cols{ std::remove_cvref_t<Ms>::NUMBER_OF_COLS... };
+
+            for (std::size_t i{ 0U }; i + 1U < sizeof...(Ms); ++i)
+            {
+                if (cols[i] != rows[i + 1U]) return false;
+            }
+            return true;
+        }();
+
+        // Classic dynamic programming over dimensions d0 x d1, d1 x d2, ..., d(K-1) x dK.
+        // split[i * K + j] is the index of the last matrix of the left part of product i..j
+        template<std::size_t K>
+        struct Order final
+        {
+            std::array<std::size_t, K * K> split{ };
+            std::array<std::size_t, K * K> cost{ };
+        };
+
+        template<std::size_t K>
+        consteval Order<K> get_order(std::array<std::size_t, K + 1U> const& dims)
+        {
+            Order<K> order{ };
+
+            for (std::size_t length{ 2U }; length <= K; ++length)
+            for (std::size_t i{ 0U }; i + length <= K; ++i)
+            {
+                std::size_t const j{ i + length - 1U };
+                order.cost[i * K + j] = std::numeric_limits<std::size_t>::max();
+
+                for (std::size_t s{ i }; s != j; ++s)
+                {
+                    std::size_t const cost{ order.cost[i * K + s] + order.cost[(s + 1U) * K + j] + dims[i] * dims[s + 1U] * dims[j + 1U] };
+                    if (cost < order.cost[i * K + j])
+                    {
+                        order.cost[i * K + j] = cost;
+                        order.split[i * K + j] = s;
+                    }
+                }
+            }
+
+            return order;
+        }
+
+        template<typename... Ms>
+        consteval std::array<std::size_t, sizeof...(Ms) + 1U> get_dims()
+        {
+            constexpr std::array rows{ Ms::NUMBER_OF_ROWS... };
+            constexpr std::array cols{ Ms::NUMBER_OF_COLS... };
+
+            std::array<std::size_t, sizeof...(Ms) + 1U> dims{ };
+            dims[0U] = rows[0U];
+            for (std::size_t i{ 0U }; i != sizeof...(Ms); ++i)
+            {
+                dims[i + 1U] = cols[i];
+            }
+            return dims;
+        }
+
+        template<typename... Ms>
+        inline constexpr Order<sizeof...(Ms)> order_v{ get_order<sizeof...(Ms)>(get_dims<Ms...>()) };
+
+        template<std::size_t I, std::size_t J, typename... Ms>
+        decltype(auto) multiply(std::tuple<Ms const&...> const& ms)
+        {
+            if constexpr (I == J)
+            {
+                return std::get<I>(ms);
+            }
+            else
+            {
+                constexpr std::size_t S{ order_v<Ms...>.split[I * sizeof...(Ms) + J] };
+                return multiply<I, S, Ms...>(ms) * multiply<S + 1U, J, Ms...>(ms);
+            }
+        }
+    }
+
+    // Number of scalar multiplications of the cheapest parenthesization
+    template<typename... Ms>
+    requires (Chain::multipliable_chain<Ms...>)
+    inline constexpr std::size_t chain_multiplication_cost_v{ Chain::order_v<Ms...>.cost[sizeof...(Ms) - 1U] };
+
+    // Product of all matrices, parenthesized at compile time to minimize number of scalar multiplications
+    template<typename... Ms>
+    requires (Chain::multipliable_chain<Ms...>)
+    auto multiply_chain(Ms const&... ms)
+    {
+        return Chain::multiply<0U, sizeof...(Ms) - 1U, Ms...>(std::tuple<Ms const&...>{ ms... });
+    }
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Auxiliry.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <functional>
+#include <cstddef>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    // Base of lazy element-wise nodes: value of an element is computed only when expression is assigned to matrix
+    struct MatrixExpressionNode { };
+
+    template<typename E>
+    concept matrix_expression_node = std::derived_from<std::remove_cvref_t<E>, MatrixExpressionNode>;
+
+    // Base of non-owning views: element is read from matrix it was taken from, also by row and column
+    struct MatrixViewNode : MatrixExpressionNode { };
+
+    template<typename E>
+    concept matrix_view_node = std::derived_from<std::remove_cvref_t<E>, MatrixViewNode>;
+
+    template<typename E>
+    concept element_wise_expression_node = matrix_expression_node<E> && !matrix_view_node<E>;
+
+    template<typename E>
+    concept matrix_expression = requires
+    {
+        std::remove_cvref_t<E>::NUMBER_OF_ROWS;
+        std::remove_cvref_t<E>::NUMBER_OF_COLS;
+        typename std::remove_cvref_t<E>::value_type;
+    } && (matrix_expression_node<E> || requires (std::remove_cvref_t<E> const& e) { e.flattern()[0U]; });
+
+    template<typename L, typename R>
+    concept same_shape_expressions = matrix_expression<L> && matrix_expression<R> &&
+        std::remove_cvref_t<L>::NUMBER_OF_ROWS == std::remove_cvref_t<R>::NUMBER_OF_ROWS &&
+        std::remove_cvref_t<L>::NUMBER_OF_COLS == std::remove_cvref_t<R>::NUMBER_OF_COLS &&
+        std::same_as<typename std::remove_cvref_t<L>::value_type, typename std::remove_cvref_t<R>::value_type>;
+
+    // Named matrices are captured by reference, temporaries and nodes by value,
+    // so expression never outlives its operands
+    template<typename E>
+    using expression_operand_t = std::conditional_t<!matrix_expression_node<E> && std::is_lvalue_reference_v<E>, std::remove_cvref_t<E> const&, std::remove_cvref_t<E>>;
+
+    template<matrix_expression E>
+    constexpr decltype(auto) get_element(E const& e, std::size_t i) noexcept(noexcept(e.get_element(i)))
+    requires (matrix_expression_node<E>)
+    {
+        return e.get_element(i);
+    }
+
+    template<matrix_expression E>
+    constexpr decltype(auto) get_element(E const& e, std::size_t i) noexcept
+    requires (!matrix_expression_node<E>)
+    {
+        return e.flattern()[i];
+    }
+
+    template<typename L, typename R, typename Op>
+    class ElementWiseExpression final : public MatrixExpressionNode
+    {
+    public:
+
+        using value_type = typename std::remove_cvref_t<L>::value_type;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ std::remove_cvref_t<L>::NUMBER_OF_ROWS };
+        static constexpr std::size_t NUMBER_OF_COLS{ std::remove_cvref_t<L>::NUMBER_OF_COLS };
+
+    public:
+
+        template<typename A, typename B>
+        constexpr ElementWiseExpression(A&& lhs, B&& rhs) noexcept(std::is_nothrow_constructible_v<L, A&&> && std::is_nothrow_constructible_v<R, B&&>)
+        :
+        lhs{ std::forward<A>(lhs) },
+        rhs{ std::forward<B>(rhs) }
+        { }
+
+        constexpr value_type get_element(std::size_t i) const noexcept(noexcept(Op{ }(std::declval<value_type const&>(), std::declval<value_type const&>())))
+        {
+            return Op{ }(Matrices::get_element(lhs, i), Matrices::get_element(rhs, i));
+        }
+
+    private:
+
+        L lhs;
+        R rhs;
+    };
+
+    template<typename E, typename Op>
+    class ScalarExpression final : public MatrixExpressionNode
+    {
+    public:
+
+        using value_type = typename std::remove_cvref_t<E>::value_type;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ std::remove_cvref_t<E>::NUMBER_OF_ROWS };
+        static constexpr std::size_t NUMBER_OF_COLS{ std::remove_cvref_t<E>::NUMBER_OF_COLS };
+
+    public:
+
+        template<typename A>
+        constexpr ScalarExpression(A&& expr, value_type const& scalar) noexcept(std::is_nothrow_constructible_v<E, A&&> && std::is_nothrow_copy_constructible_v<value_type>)
+        :
+        expr{ std::forward<A>(expr) },
+        scalar{ scalar }
+        { }
+
+        constexpr value_type get_element(std::size_t i) const noexcept(noexcept(Op{ }(std::declval<value_type const&>(), std::declval<value_type const&>())))
+        {
+            return Op{ }(Matrices::get_element(expr, i), scalar);
+        }
+
+    private:
+
+        E expr;
+        value_type scalar;
+    };
+
+    template<std::size_t M, std::size_t N, arithmetic_like T>
+    requires (M != 0U && N != 0U)
+    class Matrix;
+
+    // Expressions of small matrices are evaluated at once, so auto x{ a + b } is still a Matrix which doesn't refer to
+    // its operands, as before lazy expressions. Larger ones stay lazy until they are assigned to matrix,
+    // so auto keeps a node which refers to named operands and must not outlive them
+    inline constexpr std::size_t MAX_EAGER_ELEMENTS{ 16U };
+
+    template<typename E>
+    inline constexpr bool is_eager_v{ E::NUMBER_OF_ROWS * E::NUMBER_OF_COLS <= MAX_EAGER_ELEMENTS };
+
+    // Operands of eager expression are read before it returns, so even temporaries are not copied
+    template<typename E>
+    using result_operand_t = std::conditional_t<is_eager_v<std::remove_cvref_t<E>>, std::remove_cvref_t<E> const&, expression_operand_t<E>>;
+
+    template<typename E>
+    inline constexpr bool is_nothrow_capturable_v{ std::is_nothrow_constructible_v<result_operand_t<E>, E&&> };
+
+    template<typename E>
+    inline constexpr bool is_nothrow_result_v{ !is_eager_v<E> || noexcept(std::declval<E const&>().get_element(0U)) };
+
+    template<typename E>
+    constexpr auto get_result(E&& expr) noexcept(is_nothrow_result_v<std::remove_cvref_t<E>>)
+    {
+        using expression_type = std::remove_cvref_t<E>;
+
+        if constexpr (is_eager_v<expression_type>)
+        {
+            return Matrix<expression_type::NUMBER_OF_ROWS, expression_type::NUMBER_OF_COLS, typename expression_type::value_type>{ expr };
+        }
+        else
+        {
+            return expression_type{ std::forward<E>(expr) };
+        }
+    }
+
+    template<typename L, typename R>
+    requires (same_shape_expressions<L, R>)
+    constexpr auto operator+(L&& lhs, R&& rhs) noexcept(is_nothrow_capturable_v<L> && is_nothrow_capturable_v<R> && is_nothrow_result_v<ElementWiseExpression<result_operand_t<L>, result_operand_t<R>, std::plus<typename std::remove_cvref_t<L>::value_type>>>)
+    {
+        using value_type = typename std::remove_cvref_t<L>::value_type;
+        return get_result(ElementWiseExpression<result_operand_t<L>, result_operand_t<R>, std::plus<value_type>>{ std::forward<L>(lhs), std::forward<R>(rhs) });
+    }
+
+    template<typename L, typename R>
+    requires (same_shape_expressions<L, R>)
+    constexpr auto operator-(L&& lhs, R&& rhs) noexcept(is_nothrow_capturable_v<L> && is_nothrow_capturable_v<R> && is_nothrow_result_v<ElementWiseExpression<result_operand_t<L>, result_operand_t<R>, std::minus<typename std::remove_cvref_t<L>::value_type>>>)
+    {
+        using value_type = typename std::remove_cvref_t<L>::value_type;
+        return get_result(ElementWiseExpression<result_operand_t<L>, result_operand_t<R>, std::minus<value_type>>{ std::forward<L>(lhs), std::forward<R>(rhs) });
+    }
+
+    template<typename E>
+    requires (matrix_expression<E>)
+    constexpr auto operator*(E&& lhs, typename std::remove_cvref_t<E>::value_type const& rhs) noexcept(is_nothrow_capturable_v<E> && std::is_nothrow_copy_constructible_v<typename std::remove_cvref_t<E>::value_type> &&
+                                                                                                  is_nothrow_result_v<ScalarExpression<result_operand_t<E>, std::multiplies<typename std::remove_cvref_t<E>::value_type>>>)
+    {
+        using value_type = typename std::remove_cvref_t<E>::value_type;
+        return get_result(ScalarExpression<result_operand_t<E>, std::multiplies<value_type>>{ std::forward<E>(lhs), rhs });
+    }
+
+    template<typename E>
+    requires (matrix_expression<E>)
+    constexpr auto operator*(typename std::remove_cvref_t<E>::value_type const& lhs, E&& rhs) noexcept(noexcept(std::forward<E>(rhs) * lhs))
+    {
+        return std::forward<E>(rhs) * lhs;
+    }
+
+    template<typename E>
+    requires (matrix_expression<E>)
+    constexpr auto operator/(E&& lhs, typename std::remove_cvref_t<E>::value_type const& rhs) noexcept(is_nothrow_capturable_v<E> && std::is_nothrow_copy_constructible_v<typename std::remove_cvref_t<E>::value_type> &&
+                                                                                                  is_nothrow_result_v<ScalarExpression<result_operand_t<E>, std::divides<typename std::remove_cvref_t<E>::value_type>>>)
+    {
+        using value_type = typename std::remove_cvref_t<E>::value_type;
+        return get_result(ScalarExpression<result_operand_t<E>, std::divides<value_type>>{ std::forward<E>(lhs), rhs });
+    }
+
+    template<typename L, typename R>
+    requires (same_shape_expressions<L, R> && (matrix_expression_node<L> || matrix_expression_node<R>))
+    constexpr bool operator==(L const& lhs, R const& rhs) noexcept
+    {
+        using value_type = typename std::remove_cvref_t<L>::value_type;
+
+        for (std::size_t i{ 0U }; i != L::NUMBER_OF_ROWS * L::NUMBER_OF_COLS; ++i)
+        {
+            if constexpr (std::floating_point<value_type>)
+            {
+                if (!Auxiliry::is_equal_with_precision(static_cast<value_type>(get_element(lhs, i)), static_cast<value_type>(get_element(rhs, i)))) return false;
+            }
+            else
+            {
+                if (get_element(lhs, i) != get_element(rhs, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename L, typename R>
+    requires (same_shape_expressions<L, R> && (matrix_expression_node<L> || matrix_expression_node<R>))
+    constexpr bool operator!=(L const& lhs, R const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Simd.hpp"
+
+#include <cstddef>
+
+
+namespace GameEngine::Geometry::Matrices::Kernels
+{
+    // Sizes and types of the product lhs<M, N> * rhs<N, K> which have vectorized kernel
+    template<std::size_t M, std::size_t N, std::size_t K, typename T>
+    inline constexpr bool has_simd_multiply{ false };
+
+#if defined(GAMEENGINE_SIMD_SSE)
+    template<>
+    inline constexpr bool has_simd_multiply<3U, 3U, 3U, float>{ true };
+    template<>
+    inline constexpr bool has_simd_multiply<4U, 4U, 4U, float>{ true };
+
+    // Row i of result is sum of rhs rows weighted by elements of lhs row i,
+    // so each row is computed with broadcasts and one vector register.
+    // Summation order is the same as in scalar product, so results are identical.
+    inline void multiply_3x3(float const* lhs, float const* rhs, float* result) noexcept
+    {
+        __m128 const rhs_row_0{ _mm_loadu_ps(rhs) };
+        __m128 const rhs_row_1{ _mm_loadu_ps(rhs + 3) };
+        __m128 const rhs_tail { _mm_loadu_ps(rhs + 5) };
+        __m128 const rhs_row_2{ _mm_shuffle_ps(rhs_tail, rhs_tail, _MM_SHUFFLE(3, 3, 2, 1)) };
+
+        __m128 res_row[3U];
+        for (std::size_t i{ 0U }; i != 3U; ++i)
+        {
+            __m128 acc{ _mm_mul_ps(_mm_set1_ps(lhs[i * 3U]), rhs_row_0) };
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(lhs[i * 3U + 1U]), rhs_row_1));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(lhs[i * 3U + 2U]), rhs_row_2));
+            res_row[i] = acc;
+        }
+
+        // The 4th lane of the first two rows is overwritten by the next row
+        _mm_storeu_ps(result, res_row[0U]);
+        _mm_storeu_ps(result + 3, res_row[1U]);
+        _mm_storel_pi(reinterpret_cast<__m64*>(result + 6), res_row[2U]);
+        _mm_store_ss(result + 8, _mm_movehl_ps(res_row[2U], res_row[2U]));
+    }
+
+    inline void multiply_4x4(float const* lhs, float const* rhs, float* result) noexcept
+    {
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const rhs_row_0{ _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(rhs)) };
+        __m256 const rhs_row_1{ _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(rhs + 4)) };
+        __m256 const rhs_row_2{ _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(rhs + 8)) };
+        __m256 const rhs_row_3{ _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(rhs + 12)) };
+
+        // Two rows of lhs per iteration: each 128-bit lane handles its own row
+        for (std::size_t i{ 0U }; i != 4U; i += 2U)
+        {
+            __m256 const lhs_rows{ _mm256_loadu_ps(lhs + i * 4U) };
+
+            __m256 acc{ _mm256_mul_ps(_mm256_permute_ps(lhs_rows, _MM_SHUFFLE(0, 0, 0, 0)), rhs_row_0) };
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_permute_ps(lhs_rows, _MM_SHUFFLE(1, 1, 1, 1)), rhs_row_1));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_permute_ps(lhs_rows, _MM_SHUFFLE(2, 2, 2, 2)), rhs_row_2));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_permute_ps(lhs_rows, _MM_SHUFFLE(3, 3, 3, 3)), rhs_row_3));
+
+            _mm256_storeu_ps(result + i * 4U, acc);
+        }
+#else
+        __m128 const rhs_row_0{ _mm_loadu_ps(rhs) };
+        __m128 const rhs_row_1{ _mm_loadu_ps(rhs + 4) };
+        __m128 const rhs_row_2{ _mm_loadu_ps(rhs + 8) };
+        __m128 const rhs_row_3{ _mm_loadu_ps(rhs + 12) };
+
+        for (std::size_t i{ 0U }; i != 4U; ++i)
+        {
+            __m128 acc{ _mm_mul_ps(_mm_set1_ps(lhs[i * 4U]), rhs_row_0) };
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(lhs[i * 4U + 1U]), rhs_row_1));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(lhs[i * 4U + 2U]), rhs_row_2));
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(lhs[i * 4U + 3U]), rhs_row_3));
+
+            _mm_storeu_ps(result + i * 4U, acc);
+        }
+#endif
+    }
+#endif
+
+    // Result must not overlap with operands
+    template<std::size_t M, std::size_t N, std::size_t K, typename T>
+    requires (has_simd_multiply<M, N, K, T>)
+    inline void multiply(T const* lhs, T const* rhs, T* result) noexcept
+    {
+#if defined(GAMEENGINE_SIMD_SSE)
+        if constexpr (M == 3U)
+        {
+            multiply_3x3(lhs, rhs, result);
+        }
+        else
+        {
+            multiply_4x4(lhs, rhs, result);
+        }
+#endif
+    }
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+#include "MatrixViews.hpp"
+
+#include <array>
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    // Mutable matrix over memory owned by caller: vertex buffer, pixels of surface, data read from file.
+    // Rows and columns are arithmetic progressions, so interleaved attributes are viewed without copying,
+    // e.g. positions of vertices {x, y, u, v} are MatrixRef<K, 2, float>{ data, 4, 1 }.
+    // It is read as any other view (expressions, product, rows and columns) and supports the same
+    // in-place row and column operations as Matrix.
+    // Constness is shallow as for std::span: const member functions return read-only views, but a copy of constant
+    // MatrixRef refers to the same memory and is mutable. Pass get_view() (StridedMatrixView) to give read-only access
+    template<std::size_t M, std::size_t N, typename T>
+    class MatrixRef final : public MatrixViewNode
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ M };
+        static constexpr std::size_t NUMBER_OF_COLS{ N };
+
+    public:
+
+        constexpr MatrixRef(T* init_data, std::ptrdiff_t init_row_stride, std::ptrdiff_t init_col_stride = 1) noexcept
+        :
+        data{ init_data },
+        row_stride{ init_row_stride },
+        col_stride{ init_col_stride }
+        { }
+
+        // Dense row-major buffer
+        constexpr explicit MatrixRef(std::span<T, M * N> init_data) noexcept
+        :
+        MatrixRef{ init_data.data(), static_cast<std::ptrdiff_t>(N), 1 }
+        { }
+
+        constexpr MatrixRef(MatrixRef const&) noexcept = default;
+        constexpr MatrixRef(MatrixRef&&)      noexcept = default;
+
+        constexpr MatrixRef& operator=(MatrixRef const&) noexcept = default;
+        constexpr MatrixRef& operator=(MatrixRef&&)      noexcept = default;
+
+        constexpr ~MatrixRef() noexcept = default;
+
+        constexpr operator StridedMatrixView<M, N, T>() const noexcept
+        {
+            return get_view();
+        }
+
+
+        constexpr T const& get_element(std::size_t i, std::size_t j) const noexcept
+        {
+            assert(("Requested element must be inside of view", i < M && j < N));
+            return data[static_cast<std::ptrdiff_t>(i) * row_stride + static_cast<std::ptrdiff_t>(j) * col_stride];
+        }
+        constexpr T& get_element(std::size_t i, std::size_t j) noexcept
+        {
+            assert(("Requested element must be inside of view", i < M && j < N));
+            return data[static_cast<std::ptrdiff_t>(i) * row_stride + static_cast<std::ptrdiff_t>(j) * col_stride];
+        }
+
+        // Row-major order, the same as for Matrix::flattern
+        constexpr T const& get_element(std::size_t i) const noexcept
+        {
+            return get_element(i / N, i % N);
+        }
+
+        constexpr ViewOfMatrix<N, T> operator[](std::size_t i) const noexcept
+        {
+            return get_row(i);
+        }
+        constexpr MutableViewOfMatrix<N, T> operator[](std::size_t i) noexcept
+        {
+            return get_mutable_row(i);
+        }
+
+        constexpr ViewOfMatrix<N, T> get_row(std::size_t i) const noexcept
+        {
+            assert(("Requested row's index must not exceed the number of view's rows", i < M));
+            return ViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, data + static_cast<std::ptrdiff_t>(i) * row_stride, col_stride };
+        }
+        constexpr ViewOfMatrix<M, T> get_col(std::size_t j) const noexcept
+        {
+            assert(("Requested column's index must not exceed the number of view's columns", j < N));
+            return ViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, j, data + static_cast<std::ptrdiff_t>(j) * col_stride, row_stride };
+        }
+
+        constexpr MutableViewOfMatrix<N, T> get_mutable_row(std::size_t i) noexcept
+        {
+            assert(("Requested row's index must not exceed the number of view's rows", i < M));
+            return MutableViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, data + static_cast<std::ptrdiff_t>(i) * row_stride, col_stride };
+        }
+        constexpr MutableViewOfMatrix<M, T> get_mutable_col(std::size_t j) noexcept
+        {
+            assert(("Requested column's index must not exceed the number of view's columns", j < N));
+            return MutableViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, j, data + static_cast<std::ptrdiff_t>(j) * col_stride, row_stride };
+        }
+
+        // Pointer to the first element of row if elements of rows are contiguous, otherwise nullptr
+        constexpr T const* get_row_data(std::size_t i) const noexcept
+        {
+            assert(("Requested row's index must not exceed the number of view's rows", i < M));
+            return col_stride == 1 ? data + static_cast<std::ptrdiff_t>(i) * row_stride : nullptr;
+        }
+
+        constexpr StridedMatrixView<M, N, T> get_view() const noexcept
+        {
+            return StridedMatrixView<M, N, T>{ data, row_stride, col_stride };
+        }
+
+        // Window of rows I1..I2 and columns J1..J2 (inclusive, as in get_from). It is mutable only if called on non-const reference
+        template<std::size_t I1, std::size_t J1, std::size_t I2, std::size_t J2>
+        requires (I1 <= I2 && J1 <= J2 && I2 < M && J2 < N)
+        constexpr StridedMatrixView<I2 - I1 + 1U, J2 - J1 + 1U, T> get_from() const noexcept
+        {
+            return get_view().template get_from<I1, J1, I2, J2>();
+        }
+        template<std::size_t I1, std::size_t J1, std::size_t I2, std::size_t J2>
+        requires (I1 <= I2 && J1 <= J2 && I2 < M && J2 < N)
+        constexpr MatrixRef<I2 - I1 + 1U, J2 - J1 + 1U, T> get_from() noexcept
+        {
+            return MatrixRef<I2 - I1 + 1U, J2 - J1 + 1U, T>
+            {
+                data + static_cast<std::ptrdiff_t>(I1) * row_stride + static_cast<std::ptrdiff_t>(J1) * col_stride, row_stride, col_stride
+            };
+        }
+
+        constexpr StridedMatrixView<N, M, T> get_transponsed() const noexcept
+        {
+            return get_view().get_transponsed();
+        }
+        constexpr MatrixRef<N, M, T> get_transponsed() noexcept
+        {
+            return MatrixRef<N, M, T>{ data, col_stride, row_stride };
+        }
+
+        constexpr MinorView<M - 1U, N - 1U, T> get_minor(std::size_t I, std::size_t J) const noexcept
+        requires (M > 1U && N > 1U)
+        {
+            return get_view().get_minor(I, J);
+        }
+
+        // Expression is evaluated before it is written, so it may read referenced memory (e.g. transposition of itself)
+        template<typename E>
+        requires (same_shape_expressions<MatrixRef, E>)
+        constexpr MatrixRef& assign(E const& expr)
+        {
+            auto const& values{ evaluate(expr) };
+
+            for (std::size_t i{ 0U }; i != M; ++i)
+            for (std::size_t j{ 0U }; j != N; ++j)
+            {
+                get_element(i, j) = values.flattern()[i * N + j];
+            }
+
+            return *this;
+        }
+
+        constexpr MatrixRef& swap_rows(std::size_t lhs, std::size_t rhs) noexcept(std::is_nothrow_swappable_v<T>)
+        {
+            assert(("Requested row's index must be lesser than number of matrix rows", lhs < M));
+            assert(("Requested row's index must be lesser than number of matrix rows", rhs < M));
+
+            for (std::size_t j{ 0U }; j != N; ++j)
+            {
+                std::swap(get_element(lhs, j), get_element(rhs, j));
+            }
+
+            return *this;
+        }
+        constexpr MatrixRef& swap_cols(std::size_t lhs, std::size_t rhs) noexcept(std::is_nothrow_swappable_v<T>)
+        {
+            assert(("Requested column's index must be lesser than number of matrix columns", lhs < N));
+            assert(("Requested column's index must be lesser than number of matrix columns", rhs < N));
+
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                std::swap(get_element(i, lhs), get_element(i, rhs));
+            }
+
+            return *this;
+        }
+
+        constexpr MatrixRef& sum_rows(std::size_t from, std::size_t to, T const& from_k) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()) && std::is_nothrow_assignable_v<T, T>)
+        {
+            assert(("Index of requested row must not exceed the size of matrix", from < M));
+            assert(("Index of requested row must not exceed the size of matrix", to < M));
+            assert(("It is forbidden to add row with itself", from != to));
+
+            // Contiguous rows are walked through pointers. Source row and factor are copied first: they are in memory
+            // of caller and could alias destination, so compiler wouldn't vectorize the loop otherwise
+            if (col_stride == 1)
+            {
+                T* const dst{ data + static_cast<std::ptrdiff_t>(to) * row_stride };
+                T const* const src{ data + static_cast<std::ptrdiff_t>(from) * row_stride };
+
+                T const k{ from_k };
+                std::array<T, N> add;
+                for (std::size_t j{ 0U }; j != N; ++j)
+                {
+                    add[j] = src[j] * k;
+                }
+                for (std::size_t j{ 0U }; j != N; ++j)
+                {
+                    dst[j] = dst[j] + add[j];
+                }
+                return *this;
+            }
+
+            for (std::size_t j{ 0U }; j != N; ++j)
+            {
+                get_element(to, j) = get_element(to, j) + get_element(from, j) * from_k;
+            }
+
+            return *this;
+        }
+        constexpr MatrixRef& sum_cols(std::size_t from, std::size_t to, T const& from_k) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && noexcept(std::declval<T const&>() + std::declval<T const&>()) && std::is_nothrow_assignable_v<T, T>)
+        {
+            assert(("Index of requested column must not exceed the size of matrix", from < N));
+            assert(("Index of requested column must not exceed the size of matrix", to < N));
+            assert(("It is forbidden to add column with itself", from != to));
+
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                get_element(i, to) = get_element(i, to) + get_element(i, from) * from_k;
+            }
+
+            return *this;
+        }
+
+        constexpr MatrixRef& mul_row(std::size_t i, T const& k) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && std::is_nothrow_assignable_v<T, T>)
+        {
+            assert(("Index of requested row must not exceed the size of matrix", i < M));
+
+            if (col_stride == 1)
+            {
+                T* const row{ data + static_cast<std::ptrdiff_t>(i) * row_stride };
+
+                T const factor{ k };
+                for (std::size_t j{ 0U }; j != N; ++j)
+                {
+                    row[j] = row[j] * factor;
+                }
+                return *this;
+            }
+
+            for (std::size_t j{ 0U }; j != N; ++j)
+            {
+                get_element(i, j) = get_element(i, j) * k;
+            }
+
+            return *this;
+        }
+        constexpr MatrixRef& mul_col(std::size_t j, T const& k) noexcept(noexcept(std::declval<T const&>()* std::declval<T const&>()) && std::is_nothrow_assignable_v<T, T>)
+        {
+            assert(("Index of requested column must not exceed the size of matrix", j < N));
+
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                get_element(i, j) = get_element(i, j) * k;
+            }
+
+            return *this;
+        }
+
+    private:
+
+        T* data{ nullptr };
+        std::ptrdiff_t row_stride{ static_cast<std::ptrdiff_t>(N) };
+        std::ptrdiff_t col_stride{ 1 };
+    };
+
+    // Dense row-major buffer of exactly M * N elements
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr MatrixRef<M, N, T> get_ref(std::span<T> data) noexcept
+    {
+        assert(("Buffer must have size equal to number of elements in matrix", data.size() == M * N));
+        return MatrixRef<M, N, T>{ data.data(), static_cast<std::ptrdiff_t>(N), 1 };
+    }
+
+    // M records of buffer, each record_size elements long; columns are N consecutive elements from offset in record
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr MatrixRef<M, N, T> get_ref(std::span<T> data, std::size_t record_size, std::size_t offset = 0U) noexcept
+    {
+        assert(("Columns must fit into record", offset + N <= record_size));
+        assert(("Buffer must contain all records", data.size() >= (M - 1U) * record_size + offset + N));
+        return MatrixRef<M, N, T>{ data.data() + offset, static_cast<std::ptrdiff_t>(record_size), 1 };
+    }
+}
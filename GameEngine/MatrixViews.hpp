@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace GameEngine::Geometry::Matrices
+{
+    // Non-owning views of Matrix. They can be used as lazy expressions (construction of Matrix, evaluate, +, -, ==)
+    // and as operands of product, but don't copy elements until they are materialized.
+    // View must not outlive matrix it was taken from, so views of temporary matrices are forbidden.
+
+    template<std::size_t M, std::size_t N, typename T>
+    class MinorView;
+
+    // Rows and columns are arithmetic progressions in memory: window of matrix, whole matrix or its transposition
+    template<std::size_t M, std::size_t N, typename T>
+    class StridedMatrixView final : public MatrixViewNode
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ M };
+        static constexpr std::size_t NUMBER_OF_COLS{ N };
+
+    public:
+
+        constexpr StridedMatrixView(T const* init_data, std::ptrdiff_t init_row_stride, std::ptrdiff_t init_col_stride) noexcept
+        :
+        data{ init_data },
+        row_stride{ init_row_stride },
+        col_stride{ init_col_stride }
+        { }
+
+        constexpr StridedMatrixView(StridedMatrixView const&) noexcept = default;
+        constexpr StridedMatrixView(StridedMatrixView&&)      noexcept = default;
+
+        constexpr StridedMatrixView& operator=(StridedMatrixView const&) noexcept = default;
+        constexpr StridedMatrixView& operator=(StridedMatrixView&&)      noexcept = default;
+
+        constexpr ~StridedMatrixView() noexcept = default;
+
+
+        constexpr T const& get_element(std::size_t i, std::size_t j) const noexcept
+        {
+            assert(("Requested element must be inside of view", i < M && j < N));
+            return data[static_cast<std::ptrdiff_t>(i) * row_stride + static_cast<std::ptrdiff_t>(j) * col_stride];
+        }
+
+        // Row-major order, the same as for Matrix::flattern
+        constexpr T const& get_element(std::size_t i) const noexcept
+        {
+            return get_element(i / N, i % N);
+        }
+
+        constexpr ViewOfMatrix<N, T> get_row(std::size_t i) const noexcept
+        {
+            assert(("Requested row's index must not exceed the number of view's rows", i < M));
+            return ViewOfMatrix<N, T>{ TypeOfMatrixView::ROW, i, data + static_cast<std::ptrdiff_t>(i) * row_stride, col_stride };
+        }
+        constexpr ViewOfMatrix<M, T> get_col(std::size_t j) const noexcept
+        {
+            assert(("Requested column's index must not exceed the number of view's columns", j < N));
+            return ViewOfMatrix<M, T>{ TypeOfMatrixView::COLUMN, j, data + static_cast<std::ptrdiff_t>(j) * col_stride, row_stride };
+        }
+
+        // Pointer to the first element of row if elements of rows are contiguous (view isn't transposed), otherwise nullptr
+        constexpr T const* get_row_data(std::size_t i) const noexcept
+        {
+            assert(("Requested row's index must not exceed the number of view's rows", i < M));
+            return col_stride == 1 ? data + static_cast<std::ptrdiff_t>(i) * row_stride : nullptr;
+        }
+
+        // Window of rows I1..I2 and columns J1..J2 (inclusive, as in get_from)
+        template<std::size_t I1, std::size_t J1, std::size_t I2, std::size_t J2>
+        requires (I1 <= I2 && J1 <= J2 && I2 < M && J2 < N)
+        constexpr StridedMatrixView<I2 - I1 + 1U, J2 - J1 + 1U, T> get_from() const noexcept
+        {
+            return StridedMatrixView<I2 - I1 + 1U, J2 - J1 + 1U, T>
+            {
+                data + static_cast<std::ptrdiff_t>(I1) * row_stride + static_cast<std::ptrdiff_t>(J1) * col_stride, row_stride, col_stride
+            };
+        }
+
+        constexpr StridedMatrixView<N, M, T> get_transponsed() const noexcept
+        {
+            return StridedMatrixView<N, M, T>{ data, col_stride, row_stride };
+        }
+
+        constexpr MinorView<M - 1U, N - 1U, T> get_minor(std::size_t I, std::size_t J) const noexcept
+        requires (M > 1U && N > 1U);
+
+    private:
+
+        T const* data{ nullptr };
+        std::ptrdiff_t row_stride{ static_cast<std::ptrdiff_t>(N) };
+        std::ptrdiff_t col_stride{ 1 };
+    };
+
+    // Matrix without some rows and columns. Offsets of remaining rows and columns are kept,
+    // so minor of minor is built in O(M + N) and element is still read in O(1)
+    template<std::size_t M, std::size_t N, typename T>
+    class MinorView final : public MatrixViewNode
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t NUMBER_OF_ROWS{ M };
+        static constexpr std::size_t NUMBER_OF_COLS{ N };
+
+    public:
+
+        constexpr MinorView(T const* init_data, std::array<std::ptrdiff_t, M> const& init_rows, std::array<std::ptrdiff_t, N> const& init_cols) noexcept
+        :
+        data{ init_data },
+        rows{ init_rows },
+        cols{ init_cols }
+        { }
+
+        constexpr MinorView(MinorView const&) noexcept = default;
+        constexpr MinorView(MinorView&&)      noexcept = default;
+
+        constexpr MinorView& operator=(MinorView const&) noexcept = default;
+        constexpr MinorView& operator=(MinorView&&)      noexcept = default;
+
+        constexpr ~MinorView() noexcept = default;
+
+
+        constexpr T const& get_element(std::size_t i, std::size_t j) const noexcept
+        {
+            assert(("Requested element must be inside of view", i < M && j < N));
+            return data[rows[i] + cols[j]];
+        }
+
+        // Row-major order, the same as for Matrix::flattern
+        constexpr T const& get_element(std::size_t i) const noexcept
+        {
+            return get_element(i / N, i % N);
+        }
+
+        constexpr MinorView<M - 1U, N - 1U, T> get_minor(std::size_t I, std::size_t J) const noexcept
+        requires (M > 1U && N > 1U)
+        {
+            return MinorView<M - 1U, N - 1U, T>{ data, get_without(rows, I), get_without(cols, J) };
+        }
+
+        constexpr MinorView<N, M, T> get_transponsed() const noexcept
+        {
+            return MinorView<N, M, T>{ data, cols, rows };
+        }
+
+        template<std::size_t K>
+        static constexpr std::array<std::ptrdiff_t, K - 1U> get_without(std::array<std::ptrdiff_t, K> const& offsets, std::size_t skipped) noexcept
+        {
+            assert(("Removed index must not exceed the size of view", skipped < K));
+
+            std::array<std::ptrdiff_t, K - 1U> result{ };
+            for (std::size_t i{ 0U }, k{ 0U }; i != K; ++i)
+            {
+                if (i != skipped) result[k++] = offsets[i];
+            }
+            return result;
+        }
+
+    private:
+
+        T const* data{ nullptr };
+        std::array<std::ptrdiff_t, M> rows{ };
+        std::array<std::ptrdiff_t, N> cols{ };
+    };
+
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr MinorView<M - 1U, N - 1U, T> StridedMatrixView<M, N, T>::get_minor(std::size_t I, std::size_t J) const noexcept
+    requires (M > 1U && N > 1U)
+    {
+        std::array<std::ptrdiff_t, M> all_rows{ };
+        std::array<std::ptrdiff_t, N> all_cols{ };
+
+        for (std::size_t i{ 0U }; i != M; ++i) all_rows[i] = static_cast<std::ptrdiff_t>(i) * row_stride;
+        for (std::size_t j{ 0U }; j != N; ++j) all_cols[j] = static_cast<std::ptrdiff_t>(j) * col_stride;
+
+        return MinorView<M - 1U, N - 1U, T>
+        {
+            data,
+            MinorView<M, N, T>::get_without(all_rows, I),
+            MinorView<M, N, T>::get_without(all_cols, J)
+        };
+    }
+
+
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr StridedMatrixView<M, N, T> get_view(Matrix<M, N, T> const& m) noexcept
+    {
+        return StridedMatrixView<M, N, T>{ m.flattern().data(), static_cast<std::ptrdiff_t>(N), 1 };
+    }
+
+    template<std::size_t I1, std::size_t J1, std::size_t I2, std::size_t J2, std::size_t M, std::size_t N, typename T>
+    requires (I1 <= I2 && J1 <= J2 && I2 < M && J2 < N)
+    constexpr StridedMatrixView<I2 - I1 + 1U, J2 - J1 + 1U, T> get_view_from(Matrix<M, N, T> const& m) noexcept
+    {
+        return get_view(m).template get_from<I1, J1, I2, J2>();
+    }
+
+    template<std::size_t M, std::size_t N, typename T>
+    constexpr StridedMatrixView<N, M, T> get_transponsed_view(Matrix<M, N, T> const& m) noexcept
+    {
+        return get_view(m).get_transponsed();
+    }
+
+    template<std::size_t M, std::size_t N, typename T>
+    requires (M > 1U && N > 1U)
+    constexpr MinorView<M - 1U, N - 1U, T> get_minor_view(Matrix<M, N, T> const& m, std::size_t I, std::size_t J) noexcept
+    {
+        assert(("Requested row's index must not exceed the number of matrix's rows", I < M));
+        assert(("Requested column's index must not exceed the number of matrix's columns", J < N));
+        return get_view(m).get_minor(I, J);
+    }
+
+    // View of temporary would dangle
+    template<std::size_t M, std::size_t N, typename T>
+    void get_view(Matrix<M, N, T>&&) = delete;
+    template<std::size_t I1, std::size_t J1, std::size_t I2, std::size_t J2, std::size_t M, std::size_t N, typename T>
+    void get_view_from(Matrix<M, N, T>&&) = delete;
+    template<std::size_t M, std::size_t N, typename T>
+    void get_transponsed_view(Matrix<M, N, T>&&) = delete;
+    template<std::size_t M, std::size_t N, typename T>
+    void get_minor_view(Matrix<M, N, T>&&, std::size_t, std::size_t) = delete;
+
+
+    namespace Views
+    {
+        template<std::size_t M, std::size_t N, typename T>
+        constexpr T const& get_element(Matrix<M, N, T> const& m, std::size_t i, std::size_t j) noexcept
+        {
+            return m.flattern()[i * N + j];
+        }
+
+        template<matrix_view_node V>
+        constexpr decltype(auto) get_element(V const& v, std::size_t i, std::size_t j) noexcept
+        {
+            return v.get_element(i, j);
+        }
+
+        template<std::size_t M, std::size_t N, typename T>
+        constexpr T const* get_row_data(Matrix<M, N, T> const& m, std::size_t i) noexcept
+        {
+            return m.flattern().data() + i * N;
+        }
+
+        template<matrix_view_node V>
+        constexpr typename V::value_type const* get_row_data(V const& v, std::size_t i) noexcept
+        {
+            if constexpr (requires { v.get_row_data(i); }) return v.get_row_data(i);
+            else                                           return nullptr;
+        }
+
+        template<typename E>
+        concept readable_by_index = matrix_view_node<E> || !matrix_expression_node<E>;
+    }
+
+    // Elements are read in place, neither of operands is copied.
+    // Contiguous rows of rhs are walked through pointer, so inner loop is vectorized as for Matrix
+    template<typename L, typename R>
+    requires (matrix_expression<L> && matrix_expression<R> && (matrix_view_node<L> || matrix_view_node<R>) &&
+              Views::readable_by_index<L> && Views::readable_by_index<R> &&
+              L::NUMBER_OF_COLS == R::NUMBER_OF_ROWS && std::same_as<typename L::value_type, typename R::value_type>)
+    constexpr auto operator*(L const& lhs, R const& rhs) noexcept(noexcept(std::declval<typename L::value_type const&>() * std::declval<typename L::value_type const&>()))
+    {
+        using T = typename L::value_type;
+
+        constexpr std::size_t M{ L::NUMBER_OF_ROWS };
+        constexpr std::size_t N{ L::NUMBER_OF_COLS };
+        constexpr std::size_t K{ R::NUMBER_OF_COLS };
+
+        std::array<T, M * K> mul_result{ };
+
+        for (std::size_t i{ 0U }; i != M; ++i)
+        for (std::size_t n{ 0U }; n != N; ++n)
+        {
+            T const a{ Views::get_element(lhs, i, n) };
+            T* const out{ mul_result.data() + i * K };
+
+            if (T const* const row{ Views::get_row_data(rhs, n) }; row != nullptr)
+            {
+                for (std::size_t k{ 0U }; k != K; ++k)
+                {
+                    out[k] = out[k] + a * row[k];
+                }
+            }
+            else
+            {
+                for (std::size_t k{ 0U }; k != K; ++k)
+                {
+                    out[k] = out[k] + a * Views::get_element(rhs, n, k);
+                }
+            }
+        }
+
+        return Matrix<M, K, T>{ std::move(mul_result) };
+    }
+}
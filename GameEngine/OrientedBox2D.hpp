@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Rectangle2D.hpp"
+
+#include <array>
+#include <cmath>
+
+
+namespace GameEngine::Geometry
+{
+    // Rectangle rotated by any angle: center, two perpendicular unit axes and half of its sizes along them.
+    // Axes have no preferred direction of y, so boxes of screen (top < bottom) and world (bottom < top) look the same
+    struct OrientedBox2D final
+    {
+        static OrientedBox2D get_from_rectangle(Rectangle2D<float> const& rect) noexcept
+        {
+            return OrientedBox2D{ rect.get_center(), Vector2D<float>{ 1.f, 0.f }, Vector2D<float>{ 0.f, 1.f }, rect.get_width() / 2.f, rect.get_height() / 2.f };
+        }
+        // Box of sizes 2 * half_width and 2 * half_height rotated around its center
+        static OrientedBox2D get_from_center(Vector2D<float> const& center, float half_width, float half_height, double radians) noexcept
+        {
+            float const c{ static_cast<float>(std::cos(radians)) };
+            float const s{ static_cast<float>(std::sin(radians)) };
+            return OrientedBox2D{ center, Vector2D<float>{ c, s }, Vector2D<float>{ -s, c }, half_width, half_height };
+        }
+
+        std::array<Vector2D<float>, 4U> get_vertices() const noexcept
+        {
+            Vector2D<float> const dx{ axis_x * half_width };
+            Vector2D<float> const dy{ axis_y * half_height };
+            return std::array<Vector2D<float>, 4U>{ center - dx - dy, center + dx - dy, center + dx + dy, center - dx + dy };
+        }
+
+        bool contains(Vector2D<float> const& point) const noexcept
+        {
+            Vector2D<float> const d{ point - center };
+            return std::abs(d.x * axis_x.x + d.y * axis_x.y) <= half_width &&
+                   std::abs(d.x * axis_y.x + d.y * axis_y.y) <= half_height;
+        }
+
+        // Axis-aligned box around it, with top < bottom as for Rectangle2D::is_colided_with
+        Rectangle2D<float> get_bounding_box() const noexcept
+        {
+            float const extent_x{ std::abs(axis_x.x) * half_width + std::abs(axis_y.x) * half_height };
+            float const extent_y{ std::abs(axis_x.y) * half_width + std::abs(axis_y.y) * half_height };
+            return Rectangle2D<float>{ center.x - extent_x, center.x + extent_x, center.y + extent_y, center.y - extent_y };
+        }
+
+
+        Vector2D<float> center{ 0.f, 0.f };
+        Vector2D<float> axis_x{ 1.f, 0.f };
+        Vector2D<float> axis_y{ 0.f, 1.f };
+        float half_width{ 0.f };
+        float half_height{ 0.f };
+    };
+}
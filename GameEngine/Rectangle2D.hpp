@@ -6,7 +6,7 @@
 namespace GameEngine::Geometry
 {
     template<typename T>
-    requires (std::is_arithmetic<T>() == true)
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
     struct Rectangle2D final
     {
         [[maybe_unused]] constexpr Rectangle2D() noexcept(noexcept(T{ })) = default;
@@ -119,7 +119,7 @@ namespace GameEngine::Geometry
     };
     
     template<typename T>
-    requires (std::is_arithmetic<T>() == true)
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
     constexpr bool operator==(Rectangle2D<T> const& lhs, Rectangle2D<T> const& rhs) noexcept(noexcept(std::declval<T const&>() == std::declval<T const&>()))
     {
         return lhs.left == rhs.left && lhs.right == rhs.right && 
@@ -127,7 +127,7 @@ namespace GameEngine::Geometry
     }
     
     template<typename T>
-    requires (std::is_arithmetic<T>() == true)
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
     constexpr bool operator!=(Rectangle2D<T> const& lhs, Rectangle2D<T> const& rhs) noexcept(noexcept(std::declval<T const&>() == std::declval<T const&>()))
     {
         return !(lhs == rhs);
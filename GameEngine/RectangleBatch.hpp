@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Rectangle2D.hpp"
+#include "CollisionKernels.hpp"
+
+#include <span>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace GameEngine::Geometry
+{
+    // Array of boxes stored as structure of arrays: lefts, rights, bottoms and tops are separate contiguous lanes,
+    // so one box is tested against all of them with SIMD comparisons (CollisionKernels.hpp) instead of
+    // a loop of Rectangle2D::is_colided_with. Order of boxes is kept by insertion and erasure,
+    // so index of box is the same as index of object it belongs to.
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    class RectangleBatch final
+    {
+    public:
+
+        using value_type = T;
+
+    public:
+
+        RectangleBatch() = default;
+        explicit RectangleBatch(std::span<Rectangle2D<T> const> rects)
+        {
+            reserve(rects.size());
+            for (auto const& rect : rects)
+            {
+                push_back(rect);
+            }
+        }
+
+        RectangleBatch(RectangleBatch const&) = default;
+        RectangleBatch(RectangleBatch&&) noexcept = default;
+
+        RectangleBatch& operator=(RectangleBatch const&) = default;
+        RectangleBatch& operator=(RectangleBatch&&) noexcept = default;
+
+        ~RectangleBatch() noexcept = default;
+
+
+        std::size_t get_size() const noexcept
+        {
+            return left.size();
+        }
+        bool is_empty() const noexcept
+        {
+            return left.empty();
+        }
+
+        void reserve(std::size_t n)
+        {
+            left.reserve(n);
+            right.reserve(n);
+            bottom.reserve(n);
+            top.reserve(n);
+        }
+        void push_back(Rectangle2D<T> const& rect)
+        {
+            left.push_back(rect.left);
+            right.push_back(rect.right);
+            bottom.push_back(rect.bottom);
+            top.push_back(rect.top);
+        }
+        // Boxes after i are shifted, so order is preserved
+        void erase(std::size_t i) noexcept
+        {
+            assert(("Requested box must be inside of batch", i < get_size()));
+            left.erase(left.begin() + static_cast<std::ptrdiff_t>(i));
+            right.erase(right.begin() + static_cast<std::ptrdiff_t>(i));
+            bottom.erase(bottom.begin() + static_cast<std::ptrdiff_t>(i));
+            top.erase(top.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        void clear() noexcept
+        {
+            left.clear();
+            right.clear();
+            bottom.clear();
+            top.clear();
+        }
+
+        Rectangle2D<T> get_element(std::size_t i) const noexcept
+        {
+            assert(("Requested box must be inside of batch", i < get_size()));
+            return Rectangle2D<T>{ left[i], right[i], bottom[i], top[i] };
+        }
+        void set_element(std::size_t i, Rectangle2D<T> const& rect) noexcept
+        {
+            assert(("Requested box must be inside of batch", i < get_size()));
+            left[i]   = rect.left;
+            right[i]  = rect.right;
+            bottom[i] = rect.bottom;
+            top[i]    = rect.top;
+        }
+
+        std::span<T const> get_left() const noexcept
+        {
+            return left;
+        }
+        std::span<T const> get_right() const noexcept
+        {
+            return right;
+        }
+        std::span<T const> get_bottom() const noexcept
+        {
+            return bottom;
+        }
+        std::span<T const> get_top() const noexcept
+        {
+            return top;
+        }
+
+        // Number of 64-bit words of mask for get_collisions
+        std::size_t get_mask_size() const noexcept
+        {
+            return (get_size() + 63U) / 64U;
+        }
+
+        // Bit i % 64 of mask[i / 64] is set if box i collides with rect. mask must have get_mask_size() words
+        void get_collisions(Rectangle2D<T> const& rect, std::span<std::uint64_t> mask) const noexcept
+        {
+            assert(("Mask must have bit for every box", mask.size() >= get_mask_size()));
+            CollisionKernels::get_collision_mask(rect, left.data(), right.data(), bottom.data(), top.data(), get_size(), mask.data());
+        }
+        std::vector<std::uint64_t> get_collisions(Rectangle2D<T> const& rect) const
+        {
+            std::vector<std::uint64_t> mask(get_mask_size());
+            get_collisions(rect, mask);
+            return mask;
+        }
+
+        // Index of the first box colliding with rect or get_size() if there is none, as std::find_if would return
+        std::size_t find_first_collision(Rectangle2D<T> const& rect) const noexcept
+        {
+            return CollisionKernels::find_first_collision(rect, left.data(), right.data(), bottom.data(), top.data(), get_size());
+        }
+
+    private:
+
+        std::vector<T> left{ };
+        std::vector<T> right{ };
+        std::vector<T> bottom{ };
+        std::vector<T> top{ };
+    };
+}
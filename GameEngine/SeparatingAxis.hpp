@@ -0,0 +1,130 @@
+#pragma once
+
+#include "OrientedBox2D.hpp"
+
+#include <span>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <algorithm>
+
+
+namespace GameEngine::Geometry::SeparatingAxis
+{
+    // Separating axis theorem: two convex polygons don't intersect if and only if their projections don't overlap
+    // on the normal of some edge of either of them. Overlap is strict as in Rectangle2D::is_colided_with.
+    // For polygon that isn't convex the answer is conservative: found axis still proves separation,
+    // but separated shapes may be reported as intersected (intersected ones never as separated).
+    // Axes aren't normalized, since a scale of axis scales both projections equally.
+
+    struct Projection final
+    {
+        float min;
+        float max;
+    };
+
+    // Convex polygon prepared for tests: normals of its edges and an inner point are computed once per shape
+    struct ConvexPolygonView final
+    {
+        std::span<Vector2D<float> const> vertices;
+        std::span<Vector2D<float> const> axes;
+        Vector2D<float> center;
+    };
+
+    inline float get_dot(Vector2D<float> const& lhs, Vector2D<float> const& rhs) noexcept
+    {
+        return lhs.x * rhs.x + lhs.y * rhs.y;
+    }
+
+    // Normals of edges between consecutive vertices and of the closing edge, edges of zero length have no normal
+    inline std::vector<Vector2D<float>> get_edge_normals(std::span<Vector2D<float> const> vertices)
+    {
+        std::vector<Vector2D<float>> res{ };
+        res.reserve(vertices.size());
+
+        for (std::size_t i{ 0U }; i != vertices.size(); ++i)
+        {
+            Vector2D<float> const edge{ vertices[(i + 1U) % vertices.size()] - vertices[i] };
+            if (edge.x != 0.f || edge.y != 0.f) res.emplace_back(-edge.y, edge.x);
+        }
+        return res;
+    }
+
+    inline Vector2D<float> get_mean(std::span<Vector2D<float> const> vertices) noexcept
+    {
+        Vector2D<float> sum{ 0.f, 0.f };
+        for (auto const& vertex : vertices)
+        {
+            sum += vertex;
+        }
+        return vertices.empty() ? sum : sum * (1.f / static_cast<float>(vertices.size()));
+    }
+
+    inline Projection get_projection(std::span<Vector2D<float> const> vertices, Vector2D<float> const& axis) noexcept
+    {
+        Projection res{ std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+        for (auto const& vertex : vertices)
+        {
+            float const p{ get_dot(vertex, axis) };
+            res.min = std::min(res.min, p);
+            res.max = std::max(res.max, p);
+        }
+        return res;
+    }
+
+    inline Projection get_projection(OrientedBox2D const& box, Vector2D<float> const& axis) noexcept
+    {
+        float const c{ get_dot(box.center, axis) };
+        float const r{ std::abs(get_dot(box.axis_x, axis)) * box.half_width + std::abs(get_dot(box.axis_y, axis)) * box.half_height };
+        return Projection{ c - r, c + r };
+    }
+
+    inline bool is_overlapped(Projection const& lhs, Projection const& rhs) noexcept
+    {
+        return lhs.max > rhs.min && rhs.max > lhs.min;
+    }
+
+    template<typename L, typename R>
+    bool is_separated_on(L const& lhs, R const& rhs, Vector2D<float> const& axis) noexcept
+    {
+        return !is_overlapped(get_projection(lhs, axis), get_projection(rhs, axis));
+    }
+
+    inline bool is_intersected(OrientedBox2D const& lhs, OrientedBox2D const& rhs) noexcept
+    {
+        return !is_separated_on(lhs, rhs, lhs.axis_x) && !is_separated_on(lhs, rhs, lhs.axis_y) &&
+               !is_separated_on(lhs, rhs, rhs.axis_x) && !is_separated_on(lhs, rhs, rhs.axis_y);
+    }
+
+    // Axes which don't need normals of polygon: the line between centers (any separating line is enough to stop,
+    // it doesn't have to be a normal of edge) and axes of box. Shapes far from box are separated by them
+    inline bool is_separated_by_box(OrientedBox2D const& box, std::span<Vector2D<float> const> vertices, Vector2D<float> const& center) noexcept
+    {
+        if (vertices.empty()) return true;
+
+        if (Vector2D<float> const between{ center - box.center }; (between.x != 0.f || between.y != 0.f) && is_separated_on(box, vertices, between)) return true;
+        return is_separated_on(box, vertices, box.axis_x) || is_separated_on(box, vertices, box.axis_y);
+    }
+
+    inline bool is_separated_by_polygon(OrientedBox2D const& box, ConvexPolygonView const& polygon) noexcept
+    {
+        return std::ranges::any_of(polygon.axes, [&box, &polygon](Vector2D<float> const& axis) { return is_separated_on(box, polygon.vertices, axis); });
+    }
+
+    // Axes are tried from the cheapest and most likely separating, normals of polygon are the last
+    inline bool is_intersected(OrientedBox2D const& box, ConvexPolygonView const& polygon) noexcept
+    {
+        return !is_separated_by_box(box, polygon.vertices, polygon.center) && !is_separated_by_polygon(box, polygon);
+    }
+
+    inline bool is_intersected(ConvexPolygonView const& lhs, ConvexPolygonView const& rhs) noexcept
+    {
+        if (lhs.vertices.empty() || rhs.vertices.empty()) return false;
+
+        if (Vector2D<float> const between{ rhs.center - lhs.center }; (between.x != 0.f || between.y != 0.f) && is_separated_on(lhs.vertices, rhs.vertices, between)) return false;
+
+        auto const is_separating{ [&lhs, &rhs](Vector2D<float> const& axis) { return is_separated_on(lhs.vertices, rhs.vertices, axis); } };
+        return std::ranges::none_of(lhs.axes, is_separating) && std::ranges::none_of(rhs.axes, is_separating);
+    }
+}
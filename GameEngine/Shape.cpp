@@ -8,17 +8,128 @@ namespace GameEngine
     vertices{ std::move(init_vertices) }
     { }
 
-    Shape Shape::transform(Shape object, Geometry::Transformations2D::Mat2f const& transformation) noexcept
+    Shape Shape::transform(Shape object, Geometry::Transformations2D::Affine2D const& transformation) noexcept
     {
-        for (auto& vertex : object.vertices)
-        {
-            vertex = Geometry::Transformations2D::to_vector_form(Geometry::Transformations2D::to_matrix_form(vertex) * transformation);
-        }
+        transformation.apply(std::span{ object.vertices });
+        object.transform_caches(transformation);
         return object;
     }
 
+    Shape Shape::transform(Shape object, Geometry::Transformations2D::Mat2f const& transformation) noexcept
+    {
+        return transform(std::move(object), Geometry::Transformations2D::Affine2D{ transformation });
+    }
+
     std::vector<Shape::Vec2f> const& Shape::get_vertices() const noexcept
     {
         return vertices;
     }
+
+    Geometry::Rectangle2D<float> Shape::get_bounding_box() const noexcept
+    {
+        if (!bounding_box.has_value()) bounding_box = Geometry::get_bounding_box(vertices);
+        return *bounding_box;
+    }
+
+    Geometry::BoundingCircle Shape::get_bounding_circle() const noexcept
+    {
+        if (!bounding_circle.has_value())
+        {
+            // Hull has the same farthest point, so it is walked instead of vertices if it is already known
+            bounding_circle = Geometry::get_bounding_circle(convex_hull.has_value() ? std::span<Vec2f const>{ *convex_hull } : std::span<Vec2f const>{ vertices }, get_bounding_box());
+        }
+        return *bounding_circle;
+    }
+
+    std::vector<Shape::Vec2f> const& Shape::get_convex_hull() const
+    {
+        if (!convex_hull.has_value()) convex_hull = Geometry::get_convex_hull(vertices);
+        return *convex_hull;
+    }
+
+    Geometry::SeparatingAxis::ConvexPolygonView Shape::get_convex_polygon() const
+    {
+        if (!axes.has_value()) axes = Geometry::SeparatingAxis::get_edge_normals(vertices);
+        return Geometry::SeparatingAxis::ConvexPolygonView{ vertices, *axes, get_center() };
+    }
+
+    bool Shape::is_intersected_with(Geometry::OrientedBox2D const& box) const
+    {
+        if (vertices.empty() || !get_bounding_box().is_colided_with(box.get_bounding_box())) return false;
+
+        // Normals of edges are computed only if the axes of box don't separate, so far shapes never need them
+        if (Geometry::SeparatingAxis::is_separated_by_box(box, vertices, get_center())) return false;
+        return !Geometry::SeparatingAxis::is_separated_by_polygon(box, get_convex_polygon());
+    }
+
+    bool Shape::is_intersected_with(Shape const& shape) const
+    {
+        if (vertices.empty() || shape.vertices.empty() || !get_bounding_box().is_colided_with(shape.get_bounding_box())) return false;
+
+        return Geometry::SeparatingAxis::is_intersected(get_convex_polygon(), shape.get_convex_polygon());
+    }
+
+    Shape::Vec2f Shape::get_center() const
+    {
+        if (!center.has_value()) center = Geometry::SeparatingAxis::get_mean(vertices);
+        return *center;
+    }
+
+    // Caches are moved with vertices instead of being computed again. Mean and convex hull are kept by any affine transformation,
+    // bounding box is taken from the moved hull, which usually has fewer points than shape
+    void Shape::transform_caches(Geometry::Transformations2D::Affine2D const& transformation) noexcept
+    {
+        auto const m{ transformation.get_coefficients() };
+        float const determinant{ transformation.get_determinant() };
+
+        if (center.has_value()) center = transformation.apply(*center);
+
+        // Singular transformation collapses shape, so hull and normals would be degenerate
+        if (determinant == 0.f)
+        {
+            axes.reset();
+            convex_hull.reset();
+        }
+        if (axes.has_value())
+        {
+            // Normal of edge is transformed by cofactor matrix of linear part: det * inverse transposed
+            Geometry::Transformations2D::Affine2D const cofactor{ m[3U], -m[2U], -m[1U], m[0U], 0.f, 0.f };
+            cofactor.apply(std::span{ *axes });
+        }
+        if (convex_hull.has_value())
+        {
+            transformation.apply(std::span{ *convex_hull });
+            // Mirror turns hull clockwise
+            if (determinant < 0.f) std::ranges::reverse(*convex_hull);
+        }
+
+        if (bounding_box.has_value())
+        {
+            if (convex_hull.has_value())
+            {
+                bounding_box = Geometry::get_bounding_box(*convex_hull);
+            }
+            else if (m[0U] == 1.f && m[1U] == 0.f && m[2U] == 0.f && m[3U] == 1.f)
+            {
+                bounding_box = Geometry::Rectangle2D<float>{ bounding_box->left + m[4U], bounding_box->right + m[4U], bounding_box->bottom + m[5U], bounding_box->top + m[5U] };
+            }
+            else
+            {
+                bounding_box.reset();
+            }
+        }
+
+        // Circle is moved with its center. Radius is scaled by the largest stretch of linear part (its spectral norm),
+        // which keeps it exact for rotations and uniform scaling and bounding for the rest
+        if (bounding_circle.has_value())
+        {
+            float const a{ m[0U] * m[0U] + m[1U] * m[1U] };
+            float const b{ m[0U] * m[2U] + m[1U] * m[3U] };
+            float const c{ m[2U] * m[2U] + m[3U] * m[3U] };
+            float const half_difference{ (a - c) / 2.f };
+            float const stretch{ std::sqrt((a + c) / 2.f + std::sqrt(half_difference * half_difference + b * b)) };
+
+            bounding_circle = Geometry::BoundingCircle{ transformation.apply(bounding_circle->center), bounding_circle->radius * stretch };
+        }
+    }
 }
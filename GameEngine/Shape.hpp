@@ -1,8 +1,14 @@
 #pragma once
 
 #include <Vector2D.hpp>
-#include <Transformations2D.hpp>
+#include <Affine2D.hpp>
+#include <OrientedBox2D.hpp>
+#include <SeparatingAxis.hpp>
+#include <BoundingVolumes.hpp>
 #include <vector>
+#include <optional>
+#include <cmath>
+#include <algorithm>
 
 
 namespace GameEngine
@@ -27,10 +33,37 @@ namespace GameEngine
 
         std::vector<Vec2f> const& get_vertices() const noexcept;
 
+        // Bounding volumes are computed by the first call and kept by transform. Shape must have vertices
+        Geometry::Rectangle2D<float> get_bounding_box() const noexcept;
+        Geometry::BoundingCircle get_bounding_circle() const noexcept;
+        std::vector<Vec2f> const& get_convex_hull() const;
+
+        // Vertices with cached normals of edges for separating axis tests
+        Geometry::SeparatingAxis::ConvexPolygonView get_convex_polygon() const;
+
+        bool is_intersected_with(Geometry::OrientedBox2D const& box) const;
+        bool is_intersected_with(Shape const& shape) const;
+
+        static Shape transform(Shape object, Geometry::Transformations2D::Affine2D const& transformation) noexcept;
         static Shape transform(Shape object, Geometry::Transformations2D::Mat2f const& transformation) noexcept;
 
+    private:
+
+        Vec2f get_center() const;
+
+        void transform_caches(Geometry::Transformations2D::Affine2D const& transformation) noexcept;
+
     private:
 
         std::vector<Vec2f> vertices{ };
+
+        // Computed by the first test which needs them after vertices are changed, so shape tested many times computes them once.
+        // Not synchronized: const shape must not be tested from several threads before they are computed
+        mutable std::optional<std::vector<Vec2f>> axes{ };
+        mutable std::optional<Vec2f> center{ };
+
+        mutable std::optional<Geometry::Rectangle2D<float>> bounding_box{ };
+        mutable std::optional<Geometry::BoundingCircle> bounding_circle{ };
+        mutable std::optional<std::vector<Vec2f>> convex_hull{ };
     };
 }
@@ -0,0 +1,16 @@
+#pragma once
+
+// Instruction sets available for hand-written kernels.
+// Define GAMEENGINE_NO_SIMD to force scalar code paths everywhere.
+#if !defined(GAMEENGINE_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define GAMEENGINE_SIMD_SSE
+    #endif
+    #if defined(GAMEENGINE_SIMD_SSE) && defined(__AVX__)
+        #define GAMEENGINE_SIMD_AVX
+    #endif
+#endif
+
+#if defined(GAMEENGINE_SIMD_SSE)
+    #include <immintrin.h>
+#endif
@@ -2,8 +2,9 @@
 
 #include <KeyColor.hpp>
 #include <IModel.hpp>
-#include <Transformations2D.hpp>
+#include <StructuredTransforms2D.hpp>
 #include <Collidable.hpp>
+#include <FastMath.hpp>
 
 #include <numbers>
 #include <cmath>
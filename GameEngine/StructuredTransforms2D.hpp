@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Affine2D.hpp"
+
+#include <concepts>
+
+
+namespace GameEngine::Geometry::Transformations2D
+{
+    // Transformations with known structure. Composition of two of them uses formula for their sparsity,
+    // so only non-zero elements are computed. Result is collapsed to Affine2D only when structure is lost.
+    // Order of composition is the same as for Mat2f: lhs is applied first.
+
+    struct Translation final
+    {
+        float dx{ 0.f };
+        float dy{ 0.f };
+
+        constexpr Vec2f apply(Vec2f const& v) const noexcept
+        {
+            return Vec2f{ v.x + dx, v.y + dy };
+        }
+
+        constexpr Translation get_inversed() const noexcept
+        {
+            return Translation{ -dx, -dy };
+        }
+
+        constexpr Affine2D to_affine() const noexcept
+        {
+            return Affine2D::get_translation(dx, dy);
+        }
+    };
+
+    struct Scaling final
+    {
+        float mx{ 1.f };
+        float my{ 1.f };
+
+        constexpr Vec2f apply(Vec2f const& v) const noexcept
+        {
+            return Vec2f{ v.x * mx, v.y * my };
+        }
+
+        constexpr Scaling get_inversed() const
+        {
+            if (mx == 0.f || my == 0.f) throw std::runtime_error{ "Matrix is singular" };
+
+            return Scaling{ 1.f / mx, 1.f / my };
+        }
+
+        constexpr Affine2D to_affine() const noexcept
+        {
+            return Affine2D::get_scaling(mx, my);
+        }
+    };
+
+    // Stores cosine and sine, so composition of rotations doesn't call trigonometric functions
+    struct Rotation final
+    {
+        float c{ 1.f };
+        float s{ 0.f };
+
+        static constexpr Rotation get_from_angle(radian phi) noexcept
+        {
+            return Rotation{ ConstexprMath::cos(phi), ConstexprMath::sin(phi) };
+        }
+
+        constexpr Vec2f apply(Vec2f const& v) const noexcept
+        {
+            return Vec2f{ v.x * c + v.y * s, v.y * c - v.x * s };
+        }
+
+        constexpr Rotation get_inversed() const noexcept
+        {
+            return Rotation{ c, -s };
+        }
+
+        constexpr Affine2D to_affine() const noexcept
+        {
+            return Affine2D{ c, -s, s, c, 0.f, 0.f };
+        }
+    };
+
+    template<typename T>
+    concept structured_transform = std::same_as<T, Translation> || std::same_as<T, Scaling> || std::same_as<T, Rotation>;
+
+    constexpr Affine2D to_affine(Affine2D const& a) noexcept
+    {
+        return a;
+    }
+
+    template<structured_transform T>
+    constexpr Affine2D to_affine(T const& t) noexcept
+    {
+        return t.to_affine();
+    }
+
+    template<structured_transform T>
+    constexpr Mat2f to_matrix(T const& t) noexcept
+    {
+        return t.to_affine().to_matrix();
+    }
+
+
+    // Composition of the same kinds keeps the kind
+
+    constexpr Translation operator*(Translation const& lhs, Translation const& rhs) noexcept
+    {
+        return Translation{ lhs.dx + rhs.dx, lhs.dy + rhs.dy };
+    }
+
+    constexpr Scaling operator*(Scaling const& lhs, Scaling const& rhs) noexcept
+    {
+        return Scaling{ lhs.mx * rhs.mx, lhs.my * rhs.my };
+    }
+
+    constexpr Rotation operator*(Rotation const& lhs, Rotation const& rhs) noexcept
+    {
+        return Rotation{ lhs.c * rhs.c - lhs.s * rhs.s, lhs.s * rhs.c + lhs.c * rhs.s };
+    }
+
+
+    // Pairs of different kinds
+
+    constexpr Affine2D operator*(Translation const& lhs, Scaling const& rhs) noexcept
+    {
+        return Affine2D{ rhs.mx, 0.f, 0.f, rhs.my, lhs.dx * rhs.mx, lhs.dy * rhs.my };
+    }
+
+    constexpr Affine2D operator*(Scaling const& lhs, Translation const& rhs) noexcept
+    {
+        return Affine2D{ lhs.mx, 0.f, 0.f, lhs.my, rhs.dx, rhs.dy };
+    }
+
+    constexpr Affine2D operator*(Translation const& lhs, Rotation const& rhs) noexcept
+    {
+        return Affine2D{ rhs.c, -rhs.s, rhs.s, rhs.c, lhs.dx * rhs.c + lhs.dy * rhs.s, lhs.dy * rhs.c - lhs.dx * rhs.s };
+    }
+
+    constexpr Affine2D operator*(Rotation const& lhs, Translation const& rhs) noexcept
+    {
+        return Affine2D{ lhs.c, -lhs.s, lhs.s, lhs.c, rhs.dx, rhs.dy };
+    }
+
+    constexpr Affine2D operator*(Scaling const& lhs, Rotation const& rhs) noexcept
+    {
+        return Affine2D{ lhs.mx * rhs.c, -lhs.mx * rhs.s, lhs.my * rhs.s, lhs.my * rhs.c, 0.f, 0.f };
+    }
+
+    constexpr Affine2D operator*(Rotation const& lhs, Scaling const& rhs) noexcept
+    {
+        return Affine2D{ lhs.c * rhs.mx, -lhs.s * rhs.my, lhs.s * rhs.mx, lhs.c * rhs.my, 0.f, 0.f };
+    }
+
+
+    // Dense transformation combined with structured one
+
+    constexpr Affine2D operator*(Affine2D const& lhs, Translation const& rhs) noexcept
+    {
+        auto const m{ lhs.get_coefficients() };
+        return Affine2D{ m[0], m[1], m[2], m[3], m[4] + rhs.dx, m[5] + rhs.dy };
+    }
+
+    constexpr Affine2D operator*(Translation const& lhs, Affine2D const& rhs) noexcept
+    {
+        auto const m{ rhs.get_coefficients() };
+        return Affine2D{ m[0], m[1], m[2], m[3], lhs.dx * m[0] + lhs.dy * m[2] + m[4], lhs.dx * m[1] + lhs.dy * m[3] + m[5] };
+    }
+
+    constexpr Affine2D operator*(Affine2D const& lhs, Scaling const& rhs) noexcept
+    {
+        auto const m{ lhs.get_coefficients() };
+        return Affine2D{ m[0] * rhs.mx, m[1] * rhs.my, m[2] * rhs.mx, m[3] * rhs.my, m[4] * rhs.mx, m[5] * rhs.my };
+    }
+
+    constexpr Affine2D operator*(Scaling const& lhs, Affine2D const& rhs) noexcept
+    {
+        auto const m{ rhs.get_coefficients() };
+        return Affine2D{ lhs.mx * m[0], lhs.mx * m[1], lhs.my * m[2], lhs.my * m[3], m[4], m[5] };
+    }
+
+    constexpr Affine2D operator*(Affine2D const& lhs, Rotation const& rhs) noexcept
+    {
+        auto const m{ lhs.get_coefficients() };
+        return Affine2D
+        {
+            m[0] * rhs.c + m[1] * rhs.s, m[1] * rhs.c - m[0] * rhs.s,
+            m[2] * rhs.c + m[3] * rhs.s, m[3] * rhs.c - m[2] * rhs.s,
+            m[4] * rhs.c + m[5] * rhs.s, m[5] * rhs.c - m[4] * rhs.s
+        };
+    }
+
+    constexpr Affine2D operator*(Rotation const& lhs, Affine2D const& rhs) noexcept
+    {
+        auto const m{ rhs.get_coefficients() };
+        return Affine2D
+        {
+            lhs.c * m[0] - lhs.s * m[2], lhs.c * m[1] - lhs.s * m[3],
+            lhs.s * m[0] + lhs.c * m[2], lhs.s * m[1] + lhs.c * m[3],
+            m[4], m[5]
+        };
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Rectangle2D.hpp"
+
+#include <cmath>
+#include <limits>
+#include <cstddef>
+#include <optional>
+#include <algorithm>
+
+
+namespace GameEngine::Geometry
+{
+    // Continuous collision detection: motion along displacement is tested as a whole instead of the end position only,
+    // so fast object can't pass through another one between two checks.
+    // Rectangles have screen orientation (top < bottom) and contact uses the strict test of Rectangle2D::is_colided_with:
+    // objects collide when they start to overlap, touching isn't a collision.
+
+    // Time is fraction of displacement in [0, 1) at which objects start to overlap, normal is unit vector
+    // pointing out of obstacle at the point of contact. Objects overlapping before the motion have time 0 and zero normal
+    struct Contact final
+    {
+        float time{ 0.f };
+        Vector2D<float> normal{ 0.f, 0.f };
+    };
+
+    namespace Sweep
+    {
+        // Times when projections of moving and still segments on one axis overlap
+        struct AxisInterval final
+        {
+            float enter;
+            float exit;
+        };
+
+        inline std::optional<AxisInterval> get_axis_interval(float min_side, float max_side, float d, float obstacle_min, float obstacle_max) noexcept
+        {
+            if (d == 0.f)
+            {
+                if (min_side < obstacle_max && max_side > obstacle_min) return AxisInterval{ -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+                return std::nullopt;
+            }
+
+            float const t_min_side{ (obstacle_min - max_side) / d };
+            float const t_max_side{ (obstacle_max - min_side) / d };
+            return (d > 0.f) ? AxisInterval{ t_min_side, t_max_side } : AxisInterval{ t_max_side, t_min_side };
+        }
+    }
+
+    // Swept AABB: box moving by displacement against still obstacle (slab test of both axes)
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    std::optional<Contact> get_swept_contact(Rectangle2D<T> const& moving, Vector2D<float> const& displacement, Rectangle2D<T> const& obstacle) noexcept
+    {
+        auto const x{ Sweep::get_axis_interval(static_cast<float>(moving.left), static_cast<float>(moving.right), displacement.x, static_cast<float>(obstacle.left), static_cast<float>(obstacle.right)) };
+        if (!x.has_value()) return std::nullopt;
+        auto const y{ Sweep::get_axis_interval(static_cast<float>(moving.top), static_cast<float>(moving.bottom), displacement.y, static_cast<float>(obstacle.top), static_cast<float>(obstacle.bottom)) };
+        if (!y.has_value()) return std::nullopt;
+
+        float const enter{ std::max(x->enter, y->enter) };
+        float const exit { std::min(x->exit, y->exit) };
+        if (!(enter < exit) || !(enter < 1.f) || !(exit > 0.f)) return std::nullopt;
+        if (enter < 0.f) return Contact{ };
+
+        // The axis entered last is the side that is hit
+        if (x->enter > y->enter) return Contact{ enter, Vector2D<float>{ (displacement.x > 0.f) ? -1.f : 1.f, 0.f } };
+        return Contact{ enter, Vector2D<float>{ 0.f, (displacement.y > 0.f) ? -1.f : 1.f } };
+    }
+
+    // Circle moving by displacement against still box. Center is tested against box expanded by radius,
+    // near corners of the box it is tested against circles around them, as the rounded shape requires
+    template<typename T>
+    requires (arithmetic_like<T> && std::totally_ordered<T>)
+    std::optional<Contact> get_swept_contact(Vector2D<float> const& center, float radius, Vector2D<float> const& displacement, Rectangle2D<T> const& obstacle) noexcept
+    {
+        Rectangle2D<float> const box{ obstacle };
+
+        Vector2D<float> const closest{ std::clamp(center.x, box.left, box.right), std::clamp(center.y, box.top, box.bottom) };
+        if ((center - closest).get_square_length() < radius * radius) return Contact{ };
+
+        auto const hit{ get_swept_contact(Rectangle2D<float>{ center.x, center.x, center.y, center.y }, displacement, box.get_expanded(radius)) };
+        if (!hit.has_value()) return std::nullopt;
+
+        Vector2D<float> const point{ center + displacement * hit->time };
+        bool const is_beside_x{ point.x < box.left || point.x > box.right };
+        bool const is_beside_y{ point.y < box.top  || point.y > box.bottom };
+        if (!is_beside_x || !is_beside_y) return hit;
+
+        // Center is in corner region: the first point of circle around corner on the ray, if there is one
+        Vector2D<float> const corner{ (point.x < box.left) ? box.left : box.right, (point.y < box.top) ? box.top : box.bottom };
+        Vector2D<float> const from_corner{ center - corner };
+
+        float const a{ displacement.get_square_length() };
+        float const b{ from_corner.x * displacement.x + from_corner.y * displacement.y };
+        float const c{ from_corner.get_square_length() - radius * radius };
+        float const discriminant{ b * b - a * c };
+        if (!(b < 0.f) || discriminant < 0.f) return std::nullopt;
+
+        float const time{ std::max((-b - std::sqrt(discriminant)) / a, 0.f) };
+        if (!(time < 1.f)) return std::nullopt;
+
+        return Contact{ time, (center + displacement * time - corner) * (1.f / radius) };
+    }
+
+    // Number of equal steps of dt, so that object moving with velocity moves not farther than max_step_length per step.
+    // It is limited by max_n_steps, so a long hitch of frame doesn't stall the next one
+    inline std::size_t get_n_substeps(Vector2D<float> const& velocity, float dt, float max_step_length, std::size_t max_n_steps = 64U) noexcept
+    {
+        float const length{ std::sqrt(velocity.get_square_length()) * dt };
+        if (!(length > max_step_length)) return 1U;
+
+        return std::min(static_cast<std::size_t>(std::ceil(length / max_step_length)), max_n_steps);
+    }
+}
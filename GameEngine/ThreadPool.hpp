@@ -0,0 +1,111 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <latch>
+#include <exception>
+#include <algorithm>
+
+
+namespace GameEngine::Threading
+{
+    class ThreadPool final
+    {
+    public:
+
+        explicit ThreadPool(std::size_t n_threads = std::max(std::thread::hardware_concurrency(), 1U))
+        {
+            workers.reserve(n_threads);
+            for (std::size_t i{ 0U }; i != n_threads; ++i)
+            {
+                workers.emplace_back([this](std::stop_token stop) { worker_loop(stop); });
+            }
+        }
+        ThreadPool(ThreadPool const&) = delete;
+        ThreadPool(ThreadPool&&)      = delete;
+
+        ThreadPool& operator=(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool&&)      = delete;
+
+        ~ThreadPool()
+        {
+            for (auto& worker : workers)
+            {
+                worker.request_stop();
+            }
+            cv.notify_all();
+        }
+
+        std::size_t get_threads_count() const noexcept
+        {
+            return workers.size();
+        }
+
+        // Calls task(i) for every i in [0, count) on workers and blocks until all calls are finished.
+        // First exception thrown by task is rethrown in calling thread.
+        template<typename F>
+        void parallel_for(std::size_t count, F const& task)
+        {
+            if (count == 0U) return;
+
+            std::latch done{ static_cast<std::ptrdiff_t>(count) };
+            std::exception_ptr first_exception{ nullptr };
+            std::mutex exception_mtx{ };
+
+            {
+                std::scoped_lock lock{ mtx };
+                for (std::size_t i{ 0U }; i != count; ++i)
+                {
+                    tasks.emplace([i, &task, &done, &first_exception, &exception_mtx]()
+                    {
+                        try
+                        {
+                            task(i);
+                        }
+                        catch (...)
+                        {
+                            std::scoped_lock lock{ exception_mtx };
+                            if (!first_exception) first_exception = std::current_exception();
+                        }
+                        done.count_down();
+                    });
+                }
+            }
+            cv.notify_all();
+
+            done.wait();
+
+            if (first_exception) std::rethrow_exception(first_exception);
+        }
+
+    private:
+
+        void worker_loop(std::stop_token stop)
+        {
+            while (true)
+            {
+                std::function<void()> task{ };
+                {
+                    std::unique_lock lock{ mtx };
+                    if (!cv.wait(lock, stop, [this]() noexcept { return !tasks.empty(); })) return;
+
+                    task = std::move(tasks.front());
+                    tasks.pop();
+                }
+                task();
+            }
+        }
+
+    private:
+
+        std::mutex mtx{ };
+        std::condition_variable_any cv{ };
+        std::queue<std::function<void()>> tasks{ };
+
+        std::vector<std::jthread> workers{ };
+    };
+}
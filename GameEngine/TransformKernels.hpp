@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Simd.hpp"
+
+#include <cstddef>
+
+
+namespace GameEngine::Geometry::Transformations2D::Kernels
+{
+    // Coefficients of affine transformation are passed as { m00, m01, m10, m11, m20, m21 }:
+    //     x' = x * m00 + y * m10 + m20
+    //     y' = x * m01 + y * m11 + m21
+    // Vector paths keep the same order of operations as scalar tail, but compiler may contract scalar code into FMA
+    // (e.g. with -march=native), so results of both paths are equal only up to rounding.
+
+    inline void transform_scalar(float const* m, float& x, float& y) noexcept
+    {
+        float const new_x{ x * m[0] + y * m[2] + m[4] };
+        float const new_y{ x * m[1] + y * m[3] + m[5] };
+        x = new_x;
+        y = new_y;
+    }
+
+    // Interleaved x0, y0, x1, y1, ... (array of Vector2D<float>)
+    inline void transform_interleaved(float const* m, float* xy, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        // Every even lane is multiplied by the first row of linear part, every odd one by the second
+        __m256 const row_0{ _mm256_setr_ps(m[0], m[1], m[0], m[1], m[0], m[1], m[0], m[1]) };
+        __m256 const row_1{ _mm256_setr_ps(m[2], m[3], m[2], m[3], m[2], m[3], m[2], m[3]) };
+        __m256 const shift{ _mm256_setr_ps(m[4], m[5], m[4], m[5], m[4], m[5], m[4], m[5]) };
+
+        // 8 vertices per iteration
+        for (; i + 8U <= count; i += 8U)
+        {
+            float* const p{ xy + i * 2U };
+
+            __m256 const v0{ _mm256_loadu_ps(p) };
+            __m256 const v1{ _mm256_loadu_ps(p + 8) };
+
+            __m256 const r0{ _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_moveldup_ps(v0), row_0), _mm256_mul_ps(_mm256_movehdup_ps(v0), row_1)), shift) };
+            __m256 const r1{ _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_moveldup_ps(v1), row_0), _mm256_mul_ps(_mm256_movehdup_ps(v1), row_1)), shift) };
+
+            _mm256_storeu_ps(p, r0);
+            _mm256_storeu_ps(p + 8, r1);
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const row_0{ _mm_setr_ps(m[0], m[1], m[0], m[1]) };
+        __m128 const row_1{ _mm_setr_ps(m[2], m[3], m[2], m[3]) };
+        __m128 const shift{ _mm_setr_ps(m[4], m[5], m[4], m[5]) };
+
+        // 4 vertices per iteration
+        for (; i + 4U <= count; i += 4U)
+        {
+            float* const p{ xy + i * 2U };
+
+            __m128 const v0{ _mm_loadu_ps(p) };
+            __m128 const v1{ _mm_loadu_ps(p + 4) };
+
+            __m128 const r0{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(2, 2, 0, 0)), row_0), _mm_mul_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 3, 1, 1)), row_1)), shift) };
+            __m128 const r1{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2, 2, 0, 0)), row_0), _mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 3, 1, 1)), row_1)), shift) };
+
+            _mm_storeu_ps(p, r0);
+            _mm_storeu_ps(p + 4, r1);
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            transform_scalar(m, xy[i * 2U], xy[i * 2U + 1U]);
+        }
+    }
+
+    // Separate arrays of x and y coordinates
+    inline void transform_soa(float const* m, float* x, float* y, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const m00{ _mm256_set1_ps(m[0]) };
+        __m256 const m01{ _mm256_set1_ps(m[1]) };
+        __m256 const m10{ _mm256_set1_ps(m[2]) };
+        __m256 const m11{ _mm256_set1_ps(m[3]) };
+        __m256 const m20{ _mm256_set1_ps(m[4]) };
+        __m256 const m21{ _mm256_set1_ps(m[5]) };
+
+        // 8 vertices per iteration
+        for (; i + 8U <= count; i += 8U)
+        {
+            __m256 const vx{ _mm256_loadu_ps(x + i) };
+            __m256 const vy{ _mm256_loadu_ps(y + i) };
+
+            _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m00), _mm256_mul_ps(vy, m10)), m20));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m01), _mm256_mul_ps(vy, m11)), m21));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const m00{ _mm_set1_ps(m[0]) };
+        __m128 const m01{ _mm_set1_ps(m[1]) };
+        __m128 const m10{ _mm_set1_ps(m[2]) };
+        __m128 const m11{ _mm_set1_ps(m[3]) };
+        __m128 const m20{ _mm_set1_ps(m[4]) };
+        __m128 const m21{ _mm_set1_ps(m[5]) };
+
+        // 4 vertices per iteration
+        for (; i + 4U <= count; i += 4U)
+        {
+            __m128 const vx{ _mm_loadu_ps(x + i) };
+            __m128 const vy{ _mm_loadu_ps(y + i) };
+
+            _mm_storeu_ps(x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m00), _mm_mul_ps(vy, m10)), m20));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, m01), _mm_mul_ps(vy, m11)), m21));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            transform_scalar(m, x[i], y[i]);
+        }
+    }
+}
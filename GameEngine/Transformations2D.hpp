@@ -2,6 +2,12 @@
 
 #include "Vector2D.hpp"
 #include "Matrix.hpp"
+#include "ConstexprMath.hpp"
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <type_traits>
 
 
 namespace GameEngine::Geometry::Transformations2D
@@ -14,50 +20,79 @@ namespace GameEngine::Geometry::Transformations2D
     static constexpr float k{ 1.f };
 
 
-    inline MatVec2D to_matrix_form(Vec2f const& v) noexcept
+    // Functions below are templates over coordinate type (e.g. fixed-point numbers for bit-exact transformations),
+    // float is used by default, so get_rotation(phi) is still Mat2f
+    template<arithmetic_like T>
+    Matrices::Matrix<1U, 3U, T> to_matrix_form(Vector2D<T> const& v) noexcept
     {
-        return std::array{ v.x, v.y, k };
+        return Matrices::Matrix<1U, 3U, T>{ std::array{ v.x, v.y, static_cast<T>(k) } };
     }
 
-    inline Vec2f to_vector_form(MatVec2D const& m) noexcept
+    template<arithmetic_like T>
+    Vector2D<T> to_vector_form(Matrices::Matrix<1U, 3U, T> const& m) noexcept
     {
         auto const flattern_view{ m.flattern() };
-        assert(Auxiliry::is_equal_with_precision(flattern_view[2U], k));
-        return Vec2f{ flattern_view[0U], flattern_view[1U] };
+        if constexpr (std::floating_point<T>) assert(Auxiliry::is_equal_with_precision(flattern_view[2U], static_cast<T>(k)));
+        else                                  assert(flattern_view[2U] == static_cast<T>(k));
+        return Vector2D<T>{ flattern_view[0U], flattern_view[1U] };
     }
 
-    inline void apply(Vec2f& lhs, Mat2f const& rhs) noexcept
+    template<arithmetic_like T>
+    void apply(Vector2D<T>& lhs, Matrices::Matrix<3U, 3U, T> const& rhs) noexcept
     {
         lhs = to_vector_form(to_matrix_form(lhs) * rhs);
     }
 
-    inline Mat2f get_rotation(radian phi, float r = 1.f) noexcept
+    // Constant angle gives rotation computed at compile time
+    template<arithmetic_like T = float>
+    constexpr Matrices::Matrix<3U, 3U, T> get_rotation(radian phi, std::type_identity_t<T> r = static_cast<T>(1)) noexcept
     {
-        return std::array
-        { 
-            r * std::cosf(phi), -r * std::sinf(phi), 0.f,
-            r * std::sinf(phi), r * cosf(phi), 0.f,
-            0.f, 0.f, k
+        T const c{ r * static_cast<T>(ConstexprMath::cos(phi)) };
+        T const s{ r * static_cast<T>(ConstexprMath::sin(phi)) };
+        T const zero{ static_cast<T>(0) };
+
+        return Matrices::Matrix<3U, 3U, T>
+        {
+            std::array
+            {
+                c,    -s,   zero,
+                s,    c,    zero,
+                zero, zero, static_cast<T>(k)
+            }
         };
     }
     
-    inline Mat2f get_translation(float dx, float dy) noexcept
+    template<arithmetic_like T = float>
+    constexpr Matrices::Matrix<3U, 3U, T> get_translation(std::type_identity_t<T> dx, std::type_identity_t<T> dy) noexcept
     {
-        return std::array
+        T const zero{ static_cast<T>(0) };
+        T const one{ static_cast<T>(1) };
+
+        return Matrices::Matrix<3U, 3U, T>
         {
-            1.f, 0.f, 0.f,
-            0.f, 1.f, 0.f,
-            dx, dy, 1.f
+            std::array
+            {
+                one,  zero, zero,
+                zero, one,  zero,
+                dx,   dy,   one
+            }
         };
     }
 
-    inline Mat2f get_scaling(float mx, float my) noexcept
+    template<arithmetic_like T = float>
+    constexpr Matrices::Matrix<3U, 3U, T> get_scaling(std::type_identity_t<T> mx, std::type_identity_t<T> my) noexcept
     {
-        return std::array
+        T const zero{ static_cast<T>(0) };
+        T const one{ static_cast<T>(1) };
+
+        return Matrices::Matrix<3U, 3U, T>
         {
-            mx, 0.f, 0.f,
-            0.f, my, 0.f,
-            0.f, 0.f, 1.f
+            std::array
+            {
+                mx,   zero, zero,
+                zero, my,   zero,
+                zero, zero, one
+            }
         };
     }
 }
\ No newline at end of file
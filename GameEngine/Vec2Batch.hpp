@@ -0,0 +1,490 @@
+#pragma once
+
+#include "Vector2D.hpp"
+#include "VectorKernels.hpp"
+
+#include <new>
+#include <memory>
+#include <span>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <concepts>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+
+namespace GameEngine::Geometry
+{
+    // Array of 2D vectors stored as structure of arrays: all x coordinates, then all y coordinates, both aligned
+    // to cache line. Positions, velocities, etc. of many objects are updated with one call per array,
+    // operations on float run through SIMD kernels (VectorKernels.hpp).
+    template<arithmetic_like T>
+    class Vec2Batch final
+    {
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t ALIGNMENT{ 64U };
+
+    public:
+
+        Vec2Batch() noexcept = default;
+        // Vectors are value-initialized, i.e. zero for built-in types
+        explicit Vec2Batch(std::size_t count)
+        :
+        size{ count },
+        capacity{ get_capacity(count) },
+        data{ allocate(capacity * 2U) }
+        {
+            try
+            {
+                std::uninitialized_value_construct_n(data, capacity * 2U);
+            }
+            catch (...)
+            {
+                deallocate(data);
+                throw;
+            }
+        }
+        Vec2Batch(std::size_t count, Vector2D<T> const& value)
+        :
+        Vec2Batch{ count }
+        {
+            std::fill_n(get_x_data(), size, value.x);
+            std::fill_n(get_y_data(), size, value.y);
+        }
+        explicit Vec2Batch(std::span<Vector2D<T> const> vectors)
+        :
+        Vec2Batch{ vectors.size() }
+        {
+            assign(vectors);
+        }
+
+        Vec2Batch(Vec2Batch const& other)
+        :
+        Vec2Batch{ other.size }
+        {
+            std::copy_n(other.get_x_data(), size, get_x_data());
+            std::copy_n(other.get_y_data(), size, get_y_data());
+        }
+        Vec2Batch(Vec2Batch&& other) noexcept
+        :
+        size{ std::exchange(other.size, 0U) },
+        capacity{ std::exchange(other.capacity, 0U) },
+        data{ std::exchange(other.data, nullptr) }
+        { }
+
+        Vec2Batch& operator=(Vec2Batch const& other)
+        {
+            if (this != &other)
+            {
+                Vec2Batch tmp{ other };
+                swap(tmp);
+            }
+            return *this;
+        }
+        Vec2Batch& operator=(Vec2Batch&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                size     = std::exchange(other.size, 0U);
+                capacity = std::exchange(other.capacity, 0U);
+                data     = std::exchange(other.data, nullptr);
+            }
+            return *this;
+        }
+
+        ~Vec2Batch() noexcept
+        {
+            release();
+        }
+
+        void swap(Vec2Batch& other) noexcept
+        {
+            std::swap(size, other.size);
+            std::swap(capacity, other.capacity);
+            std::swap(data, other.data);
+        }
+
+
+        std::size_t get_size() const noexcept
+        {
+            return size;
+        }
+        bool is_empty() const noexcept
+        {
+            return size == 0U;
+        }
+
+        std::span<T const> get_x() const noexcept
+        {
+            return std::span<T const>{ get_x_data(), size };
+        }
+        std::span<T const> get_y() const noexcept
+        {
+            return std::span<T const>{ get_y_data(), size };
+        }
+        std::span<T> get_mutable_x() noexcept
+        {
+            return std::span<T>{ get_x_data(), size };
+        }
+        std::span<T> get_mutable_y() noexcept
+        {
+            return std::span<T>{ get_y_data(), size };
+        }
+
+        Vector2D<T> get_element(std::size_t i) const noexcept
+        {
+            assert(("Requested vector must be inside of batch", i < size));
+            return Vector2D<T>{ get_x_data()[i], get_y_data()[i] };
+        }
+        void set_element(std::size_t i, Vector2D<T> const& value) noexcept
+        {
+            assert(("Requested vector must be inside of batch", i < size));
+            get_x_data()[i] = value.x;
+            get_y_data()[i] = value.y;
+        }
+
+        // Conversion from and to array of structures
+        void assign(std::span<Vector2D<T> const> vectors)
+        {
+            check_size(vectors.size());
+
+            T* const x{ get_x_data() };
+            T* const y{ get_y_data() };
+            for (std::size_t i{ 0U }; i != size; ++i)
+            {
+                x[i] = vectors[i].x;
+                y[i] = vectors[i].y;
+            }
+        }
+        void copy_to(std::span<Vector2D<T>> vectors) const
+        {
+            check_size(vectors.size());
+
+            T const* const x{ get_x_data() };
+            T const* const y{ get_y_data() };
+            for (std::size_t i{ 0U }; i != size; ++i)
+            {
+                vectors[i].x = x[i];
+                vectors[i].y = y[i];
+            }
+        }
+        std::vector<Vector2D<T>> to_vector() const
+        {
+            std::vector<Vector2D<T>> res(size);
+            copy_to(res);
+            return res;
+        }
+
+
+        Vec2Batch& operator+=(Vec2Batch const& rhs)
+        {
+            check_size(rhs.size);
+
+            if constexpr (std::same_as<T, float>)
+            {
+                // Multiplication by one is exact, so it is the same as addition
+                VectorKernels::add_scaled(get_x_data(), rhs.get_x_data(), 1.f, size);
+                VectorKernels::add_scaled(get_y_data(), rhs.get_y_data(), 1.f, size);
+            }
+            else
+            {
+                transform(rhs, [](T const& a, T const& b) { return a + b; });
+            }
+            return *this;
+        }
+        Vec2Batch& operator-=(Vec2Batch const& rhs)
+        {
+            check_size(rhs.size);
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::add_scaled(get_x_data(), rhs.get_x_data(), -1.f, size);
+                VectorKernels::add_scaled(get_y_data(), rhs.get_y_data(), -1.f, size);
+            }
+            else
+            {
+                transform(rhs, [](T const& a, T const& b) { return a - b; });
+            }
+            return *this;
+        }
+        Vec2Batch& operator*=(T const& k)
+        {
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::scale(get_x_data(), k, size);
+                VectorKernels::scale(get_y_data(), k, size);
+            }
+            else
+            {
+                transform([&k](T const& a) { return a * k; });
+            }
+            return *this;
+        }
+
+        // this += rhs * k, e.g. positions.add_scaled(velocities, dt)
+        Vec2Batch& add_scaled(Vec2Batch const& rhs, T const& k)
+        {
+            check_size(rhs.size);
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::add_scaled(get_x_data(), rhs.get_x_data(), k, size);
+                VectorKernels::add_scaled(get_y_data(), rhs.get_y_data(), k, size);
+            }
+            else
+            {
+                transform(rhs, [&k](T const& a, T const& b) { return a + b * k; });
+            }
+            return *this;
+        }
+
+        // this += (target - this) * t, t = 0 keeps vectors, t = 1 gives target
+        Vec2Batch& lerp(Vec2Batch const& target, T const& t)
+        {
+            check_size(target.size);
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::lerp(get_x_data(), target.get_x_data(), t, size);
+                VectorKernels::lerp(get_y_data(), target.get_y_data(), t, size);
+            }
+            else
+            {
+                transform(target, [&t](T const& a, T const& b) { return a + (b - a) * t; });
+            }
+            return *this;
+        }
+
+        // Vectors not longer than 1e-5 are left unchanged, as by Vector2D::normalize
+        Vec2Batch& normalize() noexcept
+        requires (std::floating_point<T>)
+        {
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::normalize(get_x_data(), get_y_data(), size);
+            }
+            else
+            {
+                T* const x{ get_x_data() };
+                T* const y{ get_y_data() };
+                for (std::size_t i{ 0U }; i != size; ++i)
+                {
+                    T const len{ std::sqrt(x[i] * x[i] + y[i] * y[i]) };
+                    T const divisor{ len > static_cast<T>(VectorKernels::MIN_NORMALIZED_LENGTH) ? len : T{ 1 } };
+                    x[i] = x[i] / divisor;
+                    y[i] = y[i] / divisor;
+                }
+            }
+            return *this;
+        }
+
+        // Unlike Vector2D::rotate, coordinates are computed in T, not in double
+        Vec2Batch& rotate(double radians) noexcept
+        requires (std::floating_point<T>)
+        {
+            T const c{ static_cast<T>(std::cos(radians)) };
+            T const s{ static_cast<T>(std::sin(radians)) };
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::rotate(get_x_data(), get_y_data(), c, s, size);
+            }
+            else
+            {
+                T* const x{ get_x_data() };
+                T* const y{ get_y_data() };
+                for (std::size_t i{ 0U }; i != size; ++i)
+                {
+                    T const new_x{ x[i] * c - y[i] * s };
+                    T const new_y{ x[i] * s + y[i] * c };
+                    x[i] = new_x;
+                    y[i] = new_y;
+                }
+            }
+            return *this;
+        }
+
+        // out[i] is dot product of vector i of this batch and of rhs
+        void get_dot(Vec2Batch const& rhs, std::span<T> out) const
+        {
+            check_size(rhs.size);
+            check_size(out.size());
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::dot(out.data(), get_x_data(), get_y_data(), rhs.get_x_data(), rhs.get_y_data(), size);
+            }
+            else
+            {
+                T const* const ax{ get_x_data() };
+                T const* const ay{ get_y_data() };
+                T const* const bx{ rhs.get_x_data() };
+                T const* const by{ rhs.get_y_data() };
+                for (std::size_t i{ 0U }; i != size; ++i)
+                {
+                    out[i] = ax[i] * bx[i] + ay[i] * by[i];
+                }
+            }
+        }
+
+        // Lengths in T, while Vector2D::get_length always computes them in double
+        void get_lengths(std::span<T> out) const
+        requires (std::floating_point<T>)
+        {
+            check_size(out.size());
+
+            if constexpr (std::same_as<T, float>)
+            {
+                VectorKernels::length(out.data(), get_x_data(), get_y_data(), size);
+            }
+            else
+            {
+                T const* const x{ get_x_data() };
+                T const* const y{ get_y_data() };
+                for (std::size_t i{ 0U }; i != size; ++i)
+                {
+                    out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+                }
+            }
+        }
+
+        // Sum of all vectors; float sum is accumulated in SIMD lanes, so it may differ from sequential one by rounding
+        Vector2D<T> get_sum() const
+        {
+            if constexpr (std::same_as<T, float>)
+            {
+                return Vector2D<T>{ VectorKernels::get_sum(get_x_data(), size), VectorKernels::get_sum(get_y_data(), size) };
+            }
+            else
+            {
+                Vector2D<T> res{ T{ }, T{ } };
+                for (std::size_t i{ 0U }; i != size; ++i)
+                {
+                    res.x = res.x + get_x_data()[i];
+                    res.y = res.y + get_y_data()[i];
+                }
+                return res;
+            }
+        }
+
+        // Component-wise minimum and maximum: corners of bounding box of all points
+        Vector2D<T> get_min() const
+        requires (std::totally_ordered<T>)
+        {
+            assert(("Batch must not be empty", size != 0U));
+
+            if constexpr (std::same_as<T, float>)
+            {
+                return Vector2D<T>{ VectorKernels::get_min(get_x_data(), size), VectorKernels::get_min(get_y_data(), size) };
+            }
+            else
+            {
+                return Vector2D<T>{ *std::min_element(get_x_data(), get_x_data() + size), *std::min_element(get_y_data(), get_y_data() + size) };
+            }
+        }
+        Vector2D<T> get_max() const
+        requires (std::totally_ordered<T>)
+        {
+            assert(("Batch must not be empty", size != 0U));
+
+            if constexpr (std::same_as<T, float>)
+            {
+                return Vector2D<T>{ VectorKernels::get_max(get_x_data(), size), VectorKernels::get_max(get_y_data(), size) };
+            }
+            else
+            {
+                return Vector2D<T>{ *std::max_element(get_x_data(), get_x_data() + size), *std::max_element(get_y_data(), get_y_data() + size) };
+            }
+        }
+
+        friend bool operator==(Vec2Batch const& lhs, Vec2Batch const& rhs) noexcept
+        {
+            return std::ranges::equal(lhs.get_x(), rhs.get_x()) && std::ranges::equal(lhs.get_y(), rhs.get_y());
+        }
+        friend bool operator!=(Vec2Batch const& lhs, Vec2Batch const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+
+        // y coordinates start at the next cache line after x coordinates
+        static constexpr std::size_t get_capacity(std::size_t count) noexcept
+        {
+            if constexpr (ALIGNMENT % sizeof(T) != 0U) return count;
+
+            constexpr std::size_t PER_LINE{ ALIGNMENT / sizeof(T) };
+            return (count + PER_LINE - 1U) / PER_LINE * PER_LINE;
+        }
+
+        static T* allocate(std::size_t n)
+        {
+            if (n == 0U) return nullptr;
+            return static_cast<T*>(::operator new[](n * sizeof(T), std::align_val_t{ ALIGNMENT }));
+        }
+        static void deallocate(T* ptr) noexcept
+        {
+            if (ptr != nullptr) ::operator delete[](ptr, std::align_val_t{ ALIGNMENT });
+        }
+
+        void release() noexcept
+        {
+            if (data != nullptr)
+            {
+                std::destroy_n(data, capacity * 2U);
+                deallocate(data);
+                data = nullptr;
+            }
+        }
+
+        void check_size(std::size_t other_size) const
+        {
+            if (other_size != size) throw std::invalid_argument{ "Batches must have the same sizes" };
+        }
+
+        T* get_x_data() noexcept
+        {
+            return data;
+        }
+        T const* get_x_data() const noexcept
+        {
+            return data;
+        }
+        T* get_y_data() noexcept
+        {
+            return data + capacity;
+        }
+        T const* get_y_data() const noexcept
+        {
+            return data + capacity;
+        }
+
+        template<typename F>
+        void transform(F&& f)
+        {
+            std::transform(get_x_data(), get_x_data() + size, get_x_data(), f);
+            std::transform(get_y_data(), get_y_data() + size, get_y_data(), f);
+        }
+        template<typename F>
+        void transform(Vec2Batch const& rhs, F&& f)
+        {
+            std::transform(get_x_data(), get_x_data() + size, rhs.get_x_data(), get_x_data(), f);
+            std::transform(get_y_data(), get_y_data() + size, rhs.get_y_data(), get_y_data(), f);
+        }
+
+    private:
+
+        std::size_t size{ 0U };
+        std::size_t capacity{ 0U };
+
+        T* data{ nullptr };
+    };
+
+    using Vec2fBatch = Vec2Batch<float>;
+}
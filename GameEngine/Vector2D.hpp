@@ -10,7 +10,7 @@
 namespace GameEngine::Geometry
 { 
     template<typename T>
-    requires (std::is_arithmetic<T>() == true)
+    requires (arithmetic_like<T>)
     struct Vector2D final
     {
         [[maybe_unused]] constexpr Vector2D() noexcept(noexcept(T{ })) = default;
@@ -100,7 +100,7 @@ namespace GameEngine::Geometry
 
         [[maybe_unused]] static double get_length(Vector2D const& vec)
         {
-            return std::sqrt(get_square_length(vec));
+            return std::sqrt(static_cast<double>(get_square_length(vec)));
         }
 
         [[maybe_unused]] double get_length() const
@@ -130,7 +130,9 @@ namespace GameEngine::Geometry
 
         [[maybe_unused]] static Vector2D get_rotated(Vector2D const& vec, double radians)
         {
-            Vector2D const tmp{ static_cast<T>(vec.x * std::cos(radians) - vec.y * std::sin(radians)), static_cast<T>(vec.x * std::sin(radians) + vec.y * std::cos(radians)) };
+            double const x{ static_cast<double>(vec.x) };
+            double const y{ static_cast<double>(vec.y) };
+            Vector2D const tmp{ static_cast<T>(x * std::cos(radians) - y * std::sin(radians)), static_cast<T>(x * std::sin(radians) + y * std::cos(radians)) };
                 
             assert(Auxiliry::is_equal_with_precision(vec.get_length(), tmp.get_length(), 1e-3));
                 
@@ -0,0 +1,449 @@
+#pragma once
+
+#include "Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+
+namespace GameEngine::Geometry::VectorKernels
+{
+    // Kernels over separate arrays of x and y coordinates of float vectors (Vec2Batch<float>).
+    // Element-wise kernels keep the same operations as scalar tail, so every element gets the same result
+    // whichever path computes it (as long as compiler doesn't contract scalar code into FMA).
+    // Sum is accumulated in one partial sum per lane, so it may differ from sequential sum by rounding.
+    // get_bounds is the exception which reads interleaved coordinates (array of Vector2D<float>).
+
+    // Vectors not longer than it are left unchanged by normalize, the same precision as in Vector2D::get_normalized
+    inline constexpr float MIN_NORMALIZED_LENGTH{ 1e-5f };
+
+    // dst += src * k
+    inline void add_scaled(float* dst, float const* src, float k, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const vk{ _mm256_set1_ps(k) };
+        for (; i + 8U <= count; i += 8U)
+        {
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), vk)));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const vk{ _mm_set1_ps(k) };
+        for (; i + 4U <= count; i += 4U)
+        {
+            _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), vk)));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            dst[i] = dst[i] + src[i] * k;
+        }
+    }
+
+    inline void scale(float* dst, float k, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const vk{ _mm256_set1_ps(k) };
+        for (; i + 8U <= count; i += 8U)
+        {
+            _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(dst + i), vk));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const vk{ _mm_set1_ps(k) };
+        for (; i + 4U <= count; i += 4U)
+        {
+            _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(dst + i), vk));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            dst[i] = dst[i] * k;
+        }
+    }
+
+    // dst += (target - dst) * t
+    inline void lerp(float* dst, float const* target, float t, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const vt{ _mm256_set1_ps(t) };
+        for (; i + 8U <= count; i += 8U)
+        {
+            __m256 const a{ _mm256_loadu_ps(dst + i) };
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(target + i), a), vt)));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const vt{ _mm_set1_ps(t) };
+        for (; i + 4U <= count; i += 4U)
+        {
+            __m128 const a{ _mm_loadu_ps(dst + i) };
+            _mm_storeu_ps(dst + i, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(target + i), a), vt)));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            dst[i] = dst[i] + (target[i] - dst[i]) * t;
+        }
+    }
+
+    // out = ax * bx + ay * by
+    inline void dot(float* out, float const* ax, float const* ay, float const* bx, float const* by, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        for (; i + 8U <= count; i += 8U)
+        {
+            _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i)), _mm256_mul_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i))));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        for (; i + 4U <= count; i += 4U)
+        {
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)), _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            out[i] = ax[i] * bx[i] + ay[i] * by[i];
+        }
+    }
+
+    // Square root is correctly rounded by both sqrtps and std::sqrt, so vector and scalar results are equal
+    inline void length(float* out, float const* x, float const* y, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        for (; i + 8U <= count; i += 8U)
+        {
+            __m256 const vx{ _mm256_loadu_ps(x + i) };
+            __m256 const vy{ _mm256_loadu_ps(y + i) };
+            _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy))));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        for (; i + 4U <= count; i += 4U)
+        {
+            __m128 const vx{ _mm_loadu_ps(x + i) };
+            __m128 const vy{ _mm_loadu_ps(y + i) };
+            _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy))));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+        }
+    }
+
+    // Coordinates are divided by length (not multiplied by its inverse), as in Vector2D::get_normalized
+    inline void normalize(float* x, float* y, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const min_length{ _mm256_set1_ps(MIN_NORMALIZED_LENGTH) };
+        __m256 const one{ _mm256_set1_ps(1.f) };
+        for (; i + 8U <= count; i += 8U)
+        {
+            __m256 const vx{ _mm256_loadu_ps(x + i) };
+            __m256 const vy{ _mm256_loadu_ps(y + i) };
+            __m256 const len{ _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy))) };
+
+            // Short vectors are divided by 1 instead of branch
+            __m256 const divisor{ _mm256_blendv_ps(one, len, _mm256_cmp_ps(len, min_length, _CMP_GT_OQ)) };
+            _mm256_storeu_ps(x + i, _mm256_div_ps(vx, divisor));
+            _mm256_storeu_ps(y + i, _mm256_div_ps(vy, divisor));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const min_length{ _mm_set1_ps(MIN_NORMALIZED_LENGTH) };
+        __m128 const one{ _mm_set1_ps(1.f) };
+        for (; i + 4U <= count; i += 4U)
+        {
+            __m128 const vx{ _mm_loadu_ps(x + i) };
+            __m128 const vy{ _mm_loadu_ps(y + i) };
+            __m128 const len{ _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy))) };
+
+            // Short vectors are divided by 1 instead of branch (SSE2 has no blend)
+            __m128 const is_long{ _mm_cmpgt_ps(len, min_length) };
+            __m128 const divisor{ _mm_or_ps(_mm_and_ps(is_long, len), _mm_andnot_ps(is_long, one)) };
+            _mm_storeu_ps(x + i, _mm_div_ps(vx, divisor));
+            _mm_storeu_ps(y + i, _mm_div_ps(vy, divisor));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            float const len{ std::sqrt(x[i] * x[i] + y[i] * y[i]) };
+            float const divisor{ len > MIN_NORMALIZED_LENGTH ? len : 1.f };
+            x[i] = x[i] / divisor;
+            y[i] = y[i] / divisor;
+        }
+    }
+
+    // Rotation by angle with cosine c and sine s
+    inline void rotate(float* x, float* y, float c, float s, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 const vc{ _mm256_set1_ps(c) };
+        __m256 const vs{ _mm256_set1_ps(s) };
+        for (; i + 8U <= count; i += 8U)
+        {
+            __m256 const vx{ _mm256_loadu_ps(x + i) };
+            __m256 const vy{ _mm256_loadu_ps(y + i) };
+            _mm256_storeu_ps(x + i, _mm256_sub_ps(_mm256_mul_ps(vx, vc), _mm256_mul_ps(vy, vs)));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_mul_ps(vx, vs), _mm256_mul_ps(vy, vc)));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 const vc{ _mm_set1_ps(c) };
+        __m128 const vs{ _mm_set1_ps(s) };
+        for (; i + 4U <= count; i += 4U)
+        {
+            __m128 const vx{ _mm_loadu_ps(x + i) };
+            __m128 const vy{ _mm_loadu_ps(y + i) };
+            _mm_storeu_ps(x + i, _mm_sub_ps(_mm_mul_ps(vx, vc), _mm_mul_ps(vy, vs)));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_mul_ps(vx, vs), _mm_mul_ps(vy, vc)));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            float const new_x{ x[i] * c - y[i] * s };
+            float const new_y{ x[i] * s + y[i] * c };
+            x[i] = new_x;
+            y[i] = new_y;
+        }
+    }
+
+    inline float get_sum(float const* x, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+        float sum{ 0.f };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        __m256 acc{ _mm256_setzero_ps() };
+        for (; i + 8U <= count; i += 8U)
+        {
+            acc = _mm256_add_ps(acc, _mm256_loadu_ps(x + i));
+        }
+        __m128 const half{ _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)) };
+        __m128 const quarter{ _mm_add_ps(half, _mm_movehl_ps(half, half)) };
+        sum = _mm_cvtss_f32(_mm_add_ss(quarter, _mm_shuffle_ps(quarter, quarter, _MM_SHUFFLE(1, 1, 1, 1))));
+#elif defined(GAMEENGINE_SIMD_SSE)
+        __m128 acc{ _mm_setzero_ps() };
+        for (; i + 4U <= count; i += 4U)
+        {
+            acc = _mm_add_ps(acc, _mm_loadu_ps(x + i));
+        }
+        __m128 const half{ _mm_add_ps(acc, _mm_movehl_ps(acc, acc)) };
+        sum = _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+#endif
+
+        for (; i != count; ++i)
+        {
+            sum = sum + x[i];
+        }
+        return sum;
+    }
+
+    // Two independent accumulators hide latency of min and max instructions. count must not be zero
+    inline float get_min(float const* x, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+        float res{ x[0] };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        if (count >= 8U)
+        {
+            __m256 acc{ _mm256_loadu_ps(x) };
+            __m256 acc_1{ acc };
+            for (i = 8U; i + 16U <= count; i += 16U)
+            {
+                acc   = _mm256_min_ps(acc,   _mm256_loadu_ps(x + i));
+                acc_1 = _mm256_min_ps(acc_1, _mm256_loadu_ps(x + i + 8U));
+            }
+            acc = _mm256_min_ps(acc, acc_1);
+            for (; i + 8U <= count; i += 8U)
+            {
+                acc = _mm256_min_ps(acc, _mm256_loadu_ps(x + i));
+            }
+            __m128 const half{ _mm_min_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)) };
+            __m128 const quarter{ _mm_min_ps(half, _mm_movehl_ps(half, half)) };
+            res = _mm_cvtss_f32(_mm_min_ss(quarter, _mm_shuffle_ps(quarter, quarter, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        if (count >= 4U)
+        {
+            __m128 acc{ _mm_loadu_ps(x) };
+            __m128 acc_1{ acc };
+            for (i = 4U; i + 8U <= count; i += 8U)
+            {
+                acc   = _mm_min_ps(acc,   _mm_loadu_ps(x + i));
+                acc_1 = _mm_min_ps(acc_1, _mm_loadu_ps(x + i + 4U));
+            }
+            acc = _mm_min_ps(acc, acc_1);
+            for (; i + 4U <= count; i += 4U)
+            {
+                acc = _mm_min_ps(acc, _mm_loadu_ps(x + i));
+            }
+            __m128 const half{ _mm_min_ps(acc, _mm_movehl_ps(acc, acc)) };
+            res = _mm_cvtss_f32(_mm_min_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            res = std::min(res, x[i]);
+        }
+        return res;
+    }
+
+    // count must not be zero
+    inline float get_max(float const* x, std::size_t count) noexcept
+    {
+        std::size_t i{ 0U };
+        float res{ x[0] };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        if (count >= 8U)
+        {
+            __m256 acc{ _mm256_loadu_ps(x) };
+            __m256 acc_1{ acc };
+            for (i = 8U; i + 16U <= count; i += 16U)
+            {
+                acc   = _mm256_max_ps(acc,   _mm256_loadu_ps(x + i));
+                acc_1 = _mm256_max_ps(acc_1, _mm256_loadu_ps(x + i + 8U));
+            }
+            acc = _mm256_max_ps(acc, acc_1);
+            for (; i + 8U <= count; i += 8U)
+            {
+                acc = _mm256_max_ps(acc, _mm256_loadu_ps(x + i));
+            }
+            __m128 const half{ _mm_max_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1)) };
+            __m128 const quarter{ _mm_max_ps(half, _mm_movehl_ps(half, half)) };
+            res = _mm_cvtss_f32(_mm_max_ss(quarter, _mm_shuffle_ps(quarter, quarter, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        if (count >= 4U)
+        {
+            __m128 acc{ _mm_loadu_ps(x) };
+            __m128 acc_1{ acc };
+            for (i = 4U; i + 8U <= count; i += 8U)
+            {
+                acc   = _mm_max_ps(acc,   _mm_loadu_ps(x + i));
+                acc_1 = _mm_max_ps(acc_1, _mm_loadu_ps(x + i + 4U));
+            }
+            acc = _mm_max_ps(acc, acc_1);
+            for (; i + 4U <= count; i += 4U)
+            {
+                acc = _mm_max_ps(acc, _mm_loadu_ps(x + i));
+            }
+            __m128 const half{ _mm_max_ps(acc, _mm_movehl_ps(acc, acc)) };
+            res = _mm_cvtss_f32(_mm_max_ss(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            res = std::max(res, x[i]);
+        }
+        return res;
+    }
+
+    // Minimal and maximal x and y of count interleaved vectors x0, y0, x1, y1, ...: even lanes hold x, odd ones y,
+    // so vector accumulators reduce both coordinates at once. Two accumulators of each kind as in get_min. count must not be zero
+    inline void get_bounds(float const* xy, std::size_t count, float* min_xy, float* max_xy) noexcept
+    {
+        std::size_t i{ 0U };
+        float min_x{ xy[0] }, min_y{ xy[1] };
+        float max_x{ xy[0] }, max_y{ xy[1] };
+
+#if defined(GAMEENGINE_SIMD_AVX)
+        if (count >= 4U)
+        {
+            __m256 acc_min{ _mm256_loadu_ps(xy) };
+            __m256 acc_max{ acc_min };
+            __m256 acc_min_1{ acc_min };
+            __m256 acc_max_1{ acc_min };
+            for (i = 4U; i + 8U <= count; i += 8U)
+            {
+                __m256 const v0{ _mm256_loadu_ps(xy + i * 2U) };
+                __m256 const v1{ _mm256_loadu_ps(xy + i * 2U + 8U) };
+                acc_min   = _mm256_min_ps(acc_min,   v0);
+                acc_max   = _mm256_max_ps(acc_max,   v0);
+                acc_min_1 = _mm256_min_ps(acc_min_1, v1);
+                acc_max_1 = _mm256_max_ps(acc_max_1, v1);
+            }
+            acc_min = _mm256_min_ps(acc_min, acc_min_1);
+            acc_max = _mm256_max_ps(acc_max, acc_max_1);
+            for (; i + 4U <= count; i += 4U)
+            {
+                __m256 const v{ _mm256_loadu_ps(xy + i * 2U) };
+                acc_min = _mm256_min_ps(acc_min, v);
+                acc_max = _mm256_max_ps(acc_max, v);
+            }
+            __m128 const half_min{ _mm_min_ps(_mm256_castps256_ps128(acc_min), _mm256_extractf128_ps(acc_min, 1)) };
+            __m128 const half_max{ _mm_max_ps(_mm256_castps256_ps128(acc_max), _mm256_extractf128_ps(acc_max, 1)) };
+            __m128 const res_min{ _mm_min_ps(half_min, _mm_movehl_ps(half_min, half_min)) };
+            __m128 const res_max{ _mm_max_ps(half_max, _mm_movehl_ps(half_max, half_max)) };
+            min_x = _mm_cvtss_f32(res_min);
+            min_y = _mm_cvtss_f32(_mm_shuffle_ps(res_min, res_min, _MM_SHUFFLE(1, 1, 1, 1)));
+            max_x = _mm_cvtss_f32(res_max);
+            max_y = _mm_cvtss_f32(_mm_shuffle_ps(res_max, res_max, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+#elif defined(GAMEENGINE_SIMD_SSE)
+        if (count >= 2U)
+        {
+            __m128 acc_min{ _mm_loadu_ps(xy) };
+            __m128 acc_max{ acc_min };
+            __m128 acc_min_1{ acc_min };
+            __m128 acc_max_1{ acc_min };
+            for (i = 2U; i + 4U <= count; i += 4U)
+            {
+                __m128 const v0{ _mm_loadu_ps(xy + i * 2U) };
+                __m128 const v1{ _mm_loadu_ps(xy + i * 2U + 4U) };
+                acc_min   = _mm_min_ps(acc_min,   v0);
+                acc_max   = _mm_max_ps(acc_max,   v0);
+                acc_min_1 = _mm_min_ps(acc_min_1, v1);
+                acc_max_1 = _mm_max_ps(acc_max_1, v1);
+            }
+            acc_min = _mm_min_ps(acc_min, acc_min_1);
+            acc_max = _mm_max_ps(acc_max, acc_max_1);
+            for (; i + 2U <= count; i += 2U)
+            {
+                __m128 const v{ _mm_loadu_ps(xy + i * 2U) };
+                acc_min = _mm_min_ps(acc_min, v);
+                acc_max = _mm_max_ps(acc_max, v);
+            }
+            __m128 const res_min{ _mm_min_ps(acc_min, _mm_movehl_ps(acc_min, acc_min)) };
+            __m128 const res_max{ _mm_max_ps(acc_max, _mm_movehl_ps(acc_max, acc_max)) };
+            min_x = _mm_cvtss_f32(res_min);
+            min_y = _mm_cvtss_f32(_mm_shuffle_ps(res_min, res_min, _MM_SHUFFLE(1, 1, 1, 1)));
+            max_x = _mm_cvtss_f32(res_max);
+            max_y = _mm_cvtss_f32(_mm_shuffle_ps(res_max, res_max, _MM_SHUFFLE(1, 1, 1, 1)));
+        }
+#endif
+
+        for (; i != count; ++i)
+        {
+            min_x = std::min(min_x, xy[i * 2U]);
+            min_y = std::min(min_y, xy[i * 2U + 1U]);
+            max_x = std::max(max_x, xy[i * 2U]);
+            max_y = std::max(max_y, xy[i * 2U + 1U]);
+        }
+        min_xy[0] = min_x;
+        min_xy[1] = min_y;
+        max_xy[0] = max_x;
+        max_xy[1] = max_y;
+    }
+}
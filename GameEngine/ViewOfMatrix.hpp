@@ -1,10 +1,12 @@
 #pragma once
 
-#include <array>
 #include <optional>
 #include <cassert>
 #include <iterator>
 #include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 
 namespace GameEngine::Geometry::Matrices
@@ -15,152 +17,166 @@ namespace GameEngine::Geometry::Matrices
         ROW
     };
 
-    template<std::size_t N, typename T>
+    // N elements placed with constant distance (stride) from each other in memory:
+    // stride is 1 for row of row-major matrix and number of columns for its column.
+    // View doesn't own elements, so it must not outlive matrix it was taken from.
+    // Iterators keep position instead of moving pointer, so past-the-end iterator of column
+    // never points outside of matrix.
+    template<std::size_t N, typename T, bool IS_MUTABLE = false>
     class ViewOfMatrix final
     {
     public:
 
         static constexpr std::size_t NUMBER_OF_ELEMENTS{ N };
 
+        using value_type   = T;
+        using element_type = std::conditional_t<IS_MUTABLE, T, T const>;
+
     public:
 
-        class const_iterator final
+        template<typename E>
+        class strided_iterator final
         {
         public:
 
-            using value_type   = T;
-            using element_type = T;
+            using value_type   = std::remove_const_t<E>;
+            using element_type = E;
             using iterator_category = std::random_access_iterator_tag;
             using difference_type   = std::ptrdiff_t;
 
-            using pointer   = T const*;
-            using reference = T const&;
+            using pointer   = E*;
+            using reference = E&;
 
         public:
 
-            constexpr const_iterator() noexcept = default;
-            constexpr explicit const_iterator(const T* const* init_data)
+            constexpr strided_iterator() noexcept = default;
+            constexpr strided_iterator(E* init_data, difference_type init_stride, difference_type init_position) noexcept
             :
-            data{ init_data }
+            data{ init_data },
+            stride{ init_stride },
+            position{ init_position }
             { }
-            constexpr const_iterator(const_iterator const&) noexcept = default;
-            constexpr const_iterator(const_iterator&&)      noexcept = default;
+            constexpr strided_iterator(strided_iterator const&) noexcept = default;
+            constexpr strided_iterator(strided_iterator&&)      noexcept = default;
 
-            constexpr const_iterator& operator=(const_iterator const&) noexcept = default;
-            constexpr const_iterator& operator=(const_iterator&&)      noexcept = default;
+            constexpr strided_iterator& operator=(strided_iterator const&) noexcept = default;
+            constexpr strided_iterator& operator=(strided_iterator&&)      noexcept = default;
 
-            constexpr ~const_iterator() noexcept = default;
+            constexpr ~strided_iterator() noexcept = default;
 
 
             constexpr pointer   operator->() const noexcept
             {
                 assert(data != nullptr);
-                return *data;
+                return data + position * stride;
             }
             constexpr reference operator*()  const noexcept
             {
-                assert(data != nullptr && *data != nullptr);
-                return **data;
+                assert(data != nullptr);
+                return data[position * stride];
             }
             constexpr reference operator[](difference_type delta) const noexcept
             {
                 return *(*this + delta);
             }
 
-            constexpr const_iterator& operator+=(difference_type delta) noexcept
+            constexpr strided_iterator& operator+=(difference_type delta) noexcept
             {
-                this->data += delta;
+                position += delta;
                 return *this;
             }
-            constexpr const_iterator& operator-=(difference_type delta) noexcept
+            constexpr strided_iterator& operator-=(difference_type delta) noexcept
             {
-                this->data -= delta;
+                position -= delta;
                 return *this;
             }
 
-            constexpr const_iterator& operator++()    noexcept
+            constexpr strided_iterator& operator++()    noexcept
             {
                 return (*this += static_cast<difference_type>(1));
             }
-            constexpr const_iterator  operator++(int) noexcept
+            constexpr strided_iterator  operator++(int) noexcept
             {
                 return std::exchange(*this, *this + static_cast<difference_type>(1));
             }
 
-            constexpr const_iterator& operator--()    noexcept
+            constexpr strided_iterator& operator--()    noexcept
             {
                 return (*this -= static_cast<difference_type>(1));
             }
-            constexpr const_iterator  operator--(int) noexcept
+            constexpr strided_iterator  operator--(int) noexcept
             {
                 return std::exchange(*this, *this - static_cast<difference_type>(1));
             }
 
-            friend constexpr const_iterator operator+(const_iterator const& lhs, difference_type rhs) noexcept
+            friend constexpr strided_iterator operator+(strided_iterator const& lhs, difference_type rhs) noexcept
             {
-                return const_iterator{ lhs } += rhs;
+                return strided_iterator{ lhs } += rhs;
             }
-            friend constexpr const_iterator operator+(difference_type lhs, const_iterator const& rhs) noexcept
+            friend constexpr strided_iterator operator+(difference_type lhs, strided_iterator const& rhs) noexcept
             {
-                return const_iterator{ rhs } += lhs;
+                return strided_iterator{ rhs } += lhs;
             }
 
-            friend constexpr const_iterator operator-(const_iterator const& lhs, difference_type rhs) noexcept
+            friend constexpr strided_iterator operator-(strided_iterator const& lhs, difference_type rhs) noexcept
             {
-                return const_iterator{ lhs } -= rhs;
+                return strided_iterator{ lhs } -= rhs;
             }
-            friend constexpr const_iterator operator-(difference_type lhs, const_iterator const& rhs) noexcept
+            friend constexpr difference_type operator-(strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return const_iterator{ rhs } -= lhs;
-            }
-            friend constexpr difference_type operator-(const_iterator const& lhs, const_iterator const& rhs) noexcept
-            {
-                return lhs.data - rhs.data;
+                assert(("Iterators must belong to the same view", lhs.data == rhs.data));
+                return lhs.position - rhs.position;
             }
 
-            friend constexpr bool operator==(const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator==(strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return lhs.data == rhs.data;
+                return lhs.data == rhs.data && lhs.position == rhs.position;
             }
-            friend constexpr bool operator!=(const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator!=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
                 return !(lhs == rhs);
             }
 
-            friend constexpr bool operator< (const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator< (strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return lhs.data < rhs.data;
+                assert(("Iterators must belong to the same view", lhs.data == rhs.data));
+                return lhs.position < rhs.position;
             }
-            friend constexpr bool operator> (const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator> (strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return (lhs < rhs) && lhs != rhs;
+                return rhs < lhs;
             }
-            friend constexpr bool operator<=(const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator<=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return lhs < rhs || lhs == rhs;
+                return !(rhs < lhs);
             }
-            friend constexpr bool operator>=(const_iterator const& lhs, const_iterator const& rhs) noexcept
+            friend constexpr bool operator>=(strided_iterator const& lhs, strided_iterator const& rhs) noexcept
             {
-                return lhs > rhs || lhs == rhs;
+                return !(lhs < rhs);
             }
 
         private:
 
-            const T* const* data{ nullptr };
+            E* data{ nullptr };
+            difference_type stride{ 1 };
+            difference_type position{ 0 };
         };
+
+        using const_iterator = strided_iterator<T const>;
+        using iterator       = strided_iterator<element_type>;
+
         static_assert(std::random_access_iterator<const_iterator>);
+        static_assert(std::random_access_iterator<iterator>);
 
     public:
 
         constexpr ViewOfMatrix() = default;
-
-        template<typename... Args>
-        requires (sizeof...(Args) == N && (std::is_same_v<Args, T const*> && ...))
-        constexpr ViewOfMatrix(TypeOfMatrixView init_type, std::size_t init_index, Args&&... init_data) noexcept
+        constexpr ViewOfMatrix(TypeOfMatrixView init_type, std::size_t init_index, element_type* init_data, std::ptrdiff_t init_stride) noexcept
         :
         type{ init_type },
         index{ init_index },
-        data{ { std::forward<Args>(init_data)... } }
+        data{ init_data },
+        stride{ init_stride }
         { }
 
         constexpr ViewOfMatrix(ViewOfMatrix const&) = default;
@@ -171,38 +187,69 @@ namespace GameEngine::Geometry::Matrices
 
         constexpr ~ViewOfMatrix() = default;
 
+        // Mutable view can be read as a constant one
+        constexpr operator ViewOfMatrix<N, T, false>() const noexcept
+        requires (IS_MUTABLE)
+        {
+            return ViewOfMatrix<N, T, false>{ type, index, data, stride };
+        }
+
 
         constexpr std::optional<TypeOfMatrixView> get_type()  const noexcept
         {
-            return type;
+            return data != nullptr ? std::optional{ type } : std::nullopt;
         }
         constexpr std::optional<std::size_t>      get_index() const noexcept
         {
-            return index;
+            return data != nullptr ? std::optional{ index } : std::nullopt;
+        }
+
+        constexpr std::ptrdiff_t get_stride() const noexcept
+        {
+            return stride;
+        }
+
+        // Pointer to the first element, elements are contiguous if stride is 1
+        constexpr element_type* get_data() const noexcept
+        {
+            return data;
         }
 
 
-        constexpr T const& operator[](std::size_t i) const noexcept
+        constexpr element_type& operator[](std::size_t i) const noexcept
         {
             assert(("Operand of square bracket operator must not exceed view's range", i < NUMBER_OF_ELEMENTS));
-            return *data[i];
+            return data[static_cast<std::ptrdiff_t>(i) * stride];
         }
 
 
-        constexpr const_iterator begin() const noexcept
+        constexpr iterator begin() const noexcept
+        {
+            return iterator{ data, stride, 0 };
+        }
+        constexpr iterator end()   const noexcept
+        {
+            return iterator{ data, stride, static_cast<std::ptrdiff_t>(N) };
+        }
+
+        constexpr const_iterator cbegin() const noexcept
         {
-            return const_iterator{ data.data() };
+            return const_iterator{ data, stride, 0 };
         }
-        constexpr const_iterator end()   const noexcept
+        constexpr const_iterator cend()   const noexcept
         {
-            return const_iterator{ data.data() + N };
+            return const_iterator{ data, stride, static_cast<std::ptrdiff_t>(N) };
         }
 
     private:
 
-        std::optional<TypeOfMatrixView> type { std::nullopt };
-        std::optional<std::size_t>      index{ std::nullopt };
+        TypeOfMatrixView type{ TypeOfMatrixView::ROW };
+        std::size_t index{ 0U };
 
-        std::array<T const*, N> data{ };
+        element_type* data{ nullptr };
+        std::ptrdiff_t stride{ 1 };
     };
-}
\ No newline at end of file
+
+    template<std::size_t N, typename T>
+    using MutableViewOfMatrix = ViewOfMatrix<N, T, true>;
+}
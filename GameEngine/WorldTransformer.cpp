@@ -5,9 +5,9 @@ namespace GameEngine
     Shape WorldTransformer::transform(Shape model) const noexcept
     {
         return Shape::transform(std::move(model), 
-            Geometry::Transformations2D::get_translation(accumulated_translation.x, accumulated_translation.y) * 
-            Geometry::Transformations2D::get_scaling(accumulated_scaling, accumulated_scaling) *
-            Geometry::Transformations2D::get_rotation(accumulated_rotation)          
+            Geometry::Transformations2D::Translation{ accumulated_translation.x, accumulated_translation.y } * 
+            Geometry::Transformations2D::Scaling{ accumulated_scaling, accumulated_scaling } *
+            Geometry::Transformations2D::Rotation::get_from_angle(accumulated_rotation)          
         );
     }
 
@@ -15,10 +15,7 @@ namespace GameEngine
     {
         auto const compensated_translation
         { 
-            Geometry::Transformations2D::to_vector_form
-            (
-                Geometry::Transformations2D::to_matrix_form(delta_translation) * Geometry::Transformations2D::get_rotation(-accumulated_rotation)
-            )
+            Geometry::Transformations2D::Rotation::get_from_angle(-accumulated_rotation).apply(delta_translation)
         };
         accumulated_translation += compensated_translation;
     }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Shape.hpp"
-#include "Transformations2D.hpp"
+#include "StructuredTransforms2D.hpp"
 
 
 namespace GameEngine
@@ -0,0 +1,1681 @@
+#pragma once
+
+#include <Matrix.hpp>
+#include <DynamicMatrix.hpp>
+#include <MatrixChain.hpp>
+#include <MatrixViews.hpp>
+#include <MatrixBatch.hpp>
+#include <MatrixRef.hpp>
+#include <Affine2D.hpp>
+#include <StructuredTransforms2D.hpp>
+#include <FixedPoint.hpp>
+#include <Vec2Batch.hpp>
+#include <FastMath.hpp>
+#include <RectangleBatch.hpp>
+#include <Collidable.hpp>
+#include <SeparatingAxis.hpp>
+#include <BoundingVolumes.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <array>
+#include <vector>
+#include <span>
+#include <tuple>
+#include <numbers>
+#include <cmath>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+
+namespace Benchmarks
+{
+    using namespace GameEngine::Geometry::Matrices;
+
+    enum class OutputFormat
+    {
+        TEXT,
+        CSV,
+        JSON
+    };
+
+    namespace
+    {
+        static constexpr std::string_view SEPARATOR{ "|--------------------------------------------------------------------------|" };
+
+        static constexpr std::size_t DEFAULT_ITERATIONS{ 1'000'000U };
+
+        // Forces compiler to materialize value and forget everything it knows about memory
+        template<typename T>
+        inline void do_not_optimize(T const& value) noexcept
+        {
+#if defined(_MSC_VER)
+            static void const* volatile sink{ nullptr };
+            sink = &value;
+            _ReadWriteBarrier();
+#else
+            asm volatile("" : : "r"(&value) : "memory");
+#endif
+        }
+
+        template<typename F>
+        static double measure_ns_per_op(std::size_t iterations, F&& op)
+        {
+            for (std::size_t i{ 0U }; i != iterations / 10U; ++i)
+            {
+                op();
+            }
+
+            auto const start{ std::chrono::steady_clock::now() };
+            for (std::size_t i{ 0U }; i != iterations; ++i)
+            {
+                op();
+            }
+            auto const finish{ std::chrono::steady_clock::now() };
+
+            return std::chrono::duration<double, std::nano>{ finish - start }.count() / static_cast<double>(iterations);
+        }
+
+        struct Record final
+        {
+            std::string benchmark{ };
+            std::string section{ };
+            std::string name{ };
+            double ns_per_op{ 0. };
+        };
+
+        // Text is printed as soon as result is measured, machine-readable formats are collected
+        // and printed by print_report, because JSON needs the whole list
+        struct Report final
+        {
+            OutputFormat format{ OutputFormat::TEXT };
+            std::string benchmark{ };
+            std::string section{ };
+            std::vector<Record> records{ };
+        };
+
+        static Report report{ };
+
+        static void print_benchmark_name(std::ostream& out, std::string_view name)
+        {
+            report.benchmark = name;
+            report.section.clear();
+
+            if (report.format != OutputFormat::TEXT) return;
+
+            out << SEPARATOR << "\n";
+            out << "|" << std::setfill('-') << std::left << std::setw(SEPARATOR.length() - 2) << name << std::setfill(' ') << "|\n";
+            out << SEPARATOR << "\n";
+        }
+
+        // Title of the group of results below it, e.g. size and type of matrix
+        template<typename... Args>
+        static void print_section(std::ostream& out, Args const&... args)
+        {
+            std::ostringstream title{ };
+            (title << ... << args);
+            report.section = title.str();
+
+            if (report.format == OutputFormat::TEXT) out << report.section << "\n";
+        }
+
+        static void print_result(std::ostream& out, std::string_view name, double ns_per_op)
+        {
+            if (report.format == OutputFormat::TEXT)
+            {
+                out << std::left << std::setw(48) << name << std::right << std::setw(12) << std::fixed << std::setprecision(3) << ns_per_op << " ns/op\n";
+                return;
+            }
+
+            name.remove_prefix(std::min(name.find_first_not_of(' '), name.size()));
+            report.records.push_back(Record{ report.benchmark, report.section, std::string{ name }, ns_per_op });
+        }
+
+        static std::string_view get_compiler_name() noexcept
+        {
+#if defined(__clang__)
+            return "clang " __clang_version__;
+#elif defined(__GNUC__)
+            return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+            return "msvc";
+#else
+            return "unknown";
+#endif
+        }
+
+        static std::string_view get_build_type() noexcept
+        {
+#if defined(NDEBUG)
+            return "release";
+#else
+            return "debug";
+#endif
+        }
+
+        static std::string_view get_simd_name() noexcept
+        {
+#if defined(GAMEENGINE_SIMD_AVX)
+            return "avx";
+#elif defined(GAMEENGINE_SIMD_SSE)
+            return "sse";
+#else
+            return "none";
+#endif
+        }
+
+        // Strings are quoted in both formats: names of results contain commas
+        static void print_quoted(std::ostream& out, std::string_view text, bool is_json)
+        {
+            out << '"';
+            for (char const c : text)
+            {
+                if      (c == '"')                out << (is_json ? "\\\"" : "\"\"");
+                else if (c == '\\' && is_json)    out << "\\\\";
+                else                              out << c;
+            }
+            out << '"';
+        }
+
+        template<std::size_t M, std::size_t N, typename T>
+        static Matrix<M, N, T> get_random_matrix(std::mt19937& gen)
+        {
+            std::array<T, M * N> data{ };
+
+            if constexpr (std::floating_point<T>)
+            {
+                std::uniform_real_distribution<T> dist{ static_cast<T>(-10), static_cast<T>(10) };
+                for (auto& el : data) el = dist(gen);
+            }
+            else
+            {
+                std::uniform_int_distribution<T> dist{ static_cast<T>(-10), static_cast<T>(10) };
+                for (auto& el : data) el = dist(gen);
+            }
+
+            return Matrix<M, N, T>{ std::move(data) };
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_multiplication(std::ostream& out, std::mt19937& gen, std::string_view type_name)
+        {
+            auto lhs{ get_random_matrix<M, M, T>(gen) };
+            auto rhs{ get_random_matrix<M, M, T>(gen) };
+
+            double const generic
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&lhs, &rhs]() noexcept
+                {
+                    do_not_optimize(lhs);
+                    do_not_optimize(rhs);
+                    auto const res{ multiply_generic(lhs, rhs) };
+                    do_not_optimize(res);
+                })
+            };
+            double const dispatched
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&lhs, &rhs]() noexcept
+                {
+                    do_not_optimize(lhs);
+                    do_not_optimize(rhs);
+                    auto const res{ lhs * rhs };
+                    do_not_optimize(res);
+                })
+            };
+
+            print_section(out, "Matrix<", M, ", ", M, ", ", type_name, ">", Kernels::has_simd_multiply<M, M, M, T> ? " (vectorized kernel)" : " (generic path only)");
+            print_result(out, "  multiply_generic", generic);
+            print_result(out, "  operator*", dispatched);
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_expression(std::ostream& out, std::mt19937& gen, std::string_view type_name)
+        {
+            auto a{ get_random_matrix<M, M, T>(gen) };
+            auto b{ get_random_matrix<M, M, T>(gen) };
+            auto c{ get_random_matrix<M, M, T>(gen) };
+            T k{ static_cast<T>(3) };
+
+            // Each step is materialized as it was done before lazy expressions
+            double const chained
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&a, &b, &c, &k]() noexcept
+                {
+                    do_not_optimize(a);
+                    do_not_optimize(b);
+                    do_not_optimize(c);
+                    do_not_optimize(k);
+                    Matrix<M, M, T> const scaled{ a * k };
+                    Matrix<M, M, T> const sum{ scaled + b };
+                    Matrix<M, M, T> const res{ sum - c };
+                    do_not_optimize(res);
+                })
+            };
+            double const fused
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&a, &b, &c, &k]() noexcept
+                {
+                    do_not_optimize(a);
+                    do_not_optimize(b);
+                    do_not_optimize(c);
+                    do_not_optimize(k);
+                    Matrix<M, M, T> const res{ a * k + b - c };
+                    do_not_optimize(res);
+                })
+            };
+
+            print_section(out, "a * k + b - c, Matrix<", M, ", ", M, ", ", type_name, ">");
+            print_result(out, "  chained temporaries", chained);
+            print_result(out, "  fused expression", fused);
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_small_inverse(std::ostream& out, std::mt19937& gen, std::string_view type_name)
+        {
+            auto m{ get_random_matrix<M, M, T>(gen) };
+
+            print_section(out, "Matrix<", M, ", ", M, ", ", type_name, ">");
+            print_result(out, "  get_determinant_generic", measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_determinant_generic(m) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  get_determinant (closed form)", measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_determinant(m) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  get_inversed_generic", measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_inversed_generic(m) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  get_inversed (closed form)", measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_inversed(m) };
+                do_not_optimize(res);
+            }));
+        }
+
+        template<typename... Ms>
+        static void benchmark_matrix_chain(std::ostream& out, std::mt19937& gen, std::string_view name)
+        {
+            std::tuple<Ms...> ms{ get_random_matrix<Ms::NUMBER_OF_ROWS, Ms::NUMBER_OF_COLS, typename Ms::value_type>(gen)... };
+
+            print_section(out, name, ", multiplications: ", chain_multiplication_cost_v<Ms...>, " (optimal)");
+            print_result(out, "  left to right", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&ms]()
+            {
+                do_not_optimize(ms);
+                auto const res{ std::apply([](auto const& first, auto const&... rest) { return (evaluate(first) * ... * rest); }, ms) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  multiply_chain", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&ms]()
+            {
+                do_not_optimize(ms);
+                auto const res{ std::apply([](auto const&... m) { return multiply_chain(m...); }, ms) };
+                do_not_optimize(res);
+            }));
+        }
+
+        template<std::size_t M>
+        static void benchmark_integral_determinant(std::ostream& out, std::mt19937& gen)
+        {
+            auto const m{ get_random_matrix<M, M, std::int64_t>(gen) };
+
+            // Exact result through floating point elimination and rounding, as it was done before
+            double const detour
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+                {
+                    do_not_optimize(m);
+                    std::array<double, M * M> data{ };
+                    std::ranges::copy(m.flattern(), data.begin());
+                    auto const res{ std::llround(get_determinant(Matrix<M, M, double>{ data })) };
+                    do_not_optimize(res);
+                })
+            };
+            double const bareiss
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&m]() noexcept
+                {
+                    do_not_optimize(m);
+                    auto const res{ get_determinant(m) };
+                    do_not_optimize(res);
+                })
+            };
+            double const checked
+            {
+                measure_ns_per_op(DEFAULT_ITERATIONS, [&m]()
+                {
+                    do_not_optimize(m);
+                    auto const res{ get_determinant_checked(m) };
+                    do_not_optimize(res);
+                })
+            };
+
+            print_section(out, "Matrix<", M, ", ", M, ", int64_t>");
+            print_result(out, "  double detour", detour);
+            print_result(out, "  Bareiss", bareiss);
+            print_result(out, "  Bareiss (overflow checked)", checked);
+        }
+
+        template<typename T>
+        static DynamicMatrix<T> get_random_dynamic_matrix(std::size_t rows, std::size_t cols, std::mt19937& gen)
+        {
+            DynamicMatrix<T> m{ rows, cols };
+            std::uniform_real_distribution<T> dist{ static_cast<T>(-10), static_cast<T>(10) };
+            for (auto& el : m.flattern()) el = dist(gen);
+
+            return m;
+        }
+
+        template<typename T>
+        static void benchmark_dynamic_multiplication(std::ostream& out, std::mt19937& gen, std::size_t size, std::size_t iterations, bool with_generic, GameEngine::Threading::ThreadPool& pool)
+        {
+            auto const lhs{ get_random_dynamic_matrix<T>(size, size, gen) };
+            auto const rhs{ get_random_dynamic_matrix<T>(size, size, gen) };
+
+            print_section(out, "DynamicMatrix ", size, "x", size);
+
+            if (with_generic)
+            {
+                print_result(out, "  multiply_generic", measure_ns_per_op(iterations, [&lhs, &rhs]()
+                {
+                    auto const res{ multiply_generic(lhs, rhs) };
+                    do_not_optimize(res);
+                }));
+            }
+            print_result(out, "  multiply_blocked", measure_ns_per_op(iterations, [&lhs, &rhs]()
+            {
+                auto const res{ multiply_blocked(lhs, rhs) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  multiply_blocked (thread pool)", measure_ns_per_op(iterations, [&lhs, &rhs, &pool]()
+            {
+                auto const res{ multiply_blocked(lhs, rhs, &pool) };
+                do_not_optimize(res);
+            }));
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_iteration(std::ostream& out, std::mt19937& gen)
+        {
+            auto const m{ get_random_matrix<M, M, T>(gen) };
+
+            print_section(out, "Matrix<", M, ", ", M, ">, sum of value * (row + col)");
+            print_result(out, "  cells, it += 1 (division per step)", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&m]()
+            {
+                do_not_optimize(m);
+                T sum{ };
+                for (auto it{ m.begin() }; it != m.end(); it += 1)
+                {
+                    sum += it->get_data() * static_cast<T>(it->get_row_index() + it->get_col_index());
+                }
+                do_not_optimize(sum);
+            }));
+            print_result(out, "  cells, range-for", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&m]()
+            {
+                do_not_optimize(m);
+                T sum{ };
+                for (auto const& cell : m)
+                {
+                    sum += cell.get_data() * static_cast<T>(cell.get_row_index() + cell.get_col_index());
+                }
+                do_not_optimize(sum);
+            }));
+            print_result(out, "  for_each_cell", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&m]()
+            {
+                do_not_optimize(m);
+                T sum{ };
+                m.for_each_cell([&sum](std::size_t i, std::size_t j, T const& value) noexcept
+                {
+                    sum += value * static_cast<T>(i + j);
+                });
+                do_not_optimize(sum);
+            }));
+
+            print_section(out, "Matrix<", M, ", ", M, ">, sum of values");
+            print_result(out, "  cells, range-for", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&m]()
+            {
+                do_not_optimize(m);
+                T sum{ };
+                for (auto const& cell : m) sum += cell.get_data();
+                do_not_optimize(sum);
+            }));
+            print_result(out, "  get_values, range-for", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&m]()
+            {
+                do_not_optimize(m);
+                T sum{ };
+                for (T const& value : m.get_values()) sum += value;
+                do_not_optimize(sum);
+            }));
+        }
+
+        template<std::size_t M, typename T, std::size_t K>
+        static void benchmark_matrix_batch(std::ostream& out, std::mt19937& gen)
+        {
+            std::array<Matrix<M, M, T>, K> ms{ };
+            for (auto& m : ms)
+            {
+                // Dominant diagonal keeps matrices far from singular
+                m = get_random_matrix<M, M, T>(gen);
+                m += get_identity<M, T>() * static_cast<T>(40);
+            }
+
+            MatrixBatch<M, M, T, K> const batch{ ms };
+            std::size_t const iterations{ DEFAULT_ITERATIONS / K };
+
+            print_section(out, K, " x Matrix<", M, ", ", M, ">");
+            print_result(out, "  determinant, per-instance loop", measure_ns_per_op(iterations, [&ms]()
+            {
+                do_not_optimize(ms);
+                std::array<T, K> res{ };
+                for (std::size_t k{ 0U }; k != K; ++k) res[k] = get_determinant(ms[k]);
+                do_not_optimize(res);
+            }));
+            print_result(out, "  determinant, MatrixBatch", measure_ns_per_op(iterations, [&batch]()
+            {
+                do_not_optimize(batch);
+                auto const res{ get_determinant(batch) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  inverse, per-instance loop", measure_ns_per_op(iterations, [&ms]()
+            {
+                do_not_optimize(ms);
+                std::array<Matrix<M, M, T>, K> res{ };
+                for (std::size_t k{ 0U }; k != K; ++k) res[k] = get_inversed(ms[k]);
+                do_not_optimize(res);
+            }));
+            print_result(out, "  inverse, MatrixBatch", measure_ns_per_op(iterations, [&batch]()
+            {
+                do_not_optimize(batch);
+                auto const res{ get_inversed(batch) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  product, per-instance loop", measure_ns_per_op(iterations, [&ms]()
+            {
+                do_not_optimize(ms);
+                std::array<Matrix<M, M, T>, K> res{ };
+                for (std::size_t k{ 0U }; k != K; ++k) res[k] = ms[k] * ms[(k + 1U) % K];
+                do_not_optimize(res);
+            }));
+            print_result(out, "  product, MatrixBatch", measure_ns_per_op(iterations, [&batch]()
+            {
+                do_not_optimize(batch);
+                auto const res{ batch * batch };
+                do_not_optimize(res);
+            }));
+        }
+
+        // Laplace expansion along the first row, every minor is copied
+        template<std::size_t M, typename T>
+        static T get_determinant_by_cofactors(Matrix<M, M, T> const& m)
+        {
+            if constexpr (M == 1U)
+            {
+                return m.flattern()[0U];
+            }
+            else
+            {
+                T det{ };
+                T sign{ 1 };
+                for (std::size_t j{ 0U }; j != M; ++j, sign = -sign)
+                {
+                    det += sign * m.flattern()[j] * get_determinant_by_cofactors(remove_row_and_col(m, 0U, j));
+                }
+                return det;
+            }
+        }
+
+        // The same expansion over minor views
+        template<typename V>
+        static typename V::value_type get_determinant_by_cofactors_of_view(V const& v)
+        {
+            using T = typename V::value_type;
+
+            if constexpr (V::NUMBER_OF_ROWS == 1U)
+            {
+                return v.get_element(0U, 0U);
+            }
+            else
+            {
+                T det{ };
+                T sign{ 1 };
+                for (std::size_t j{ 0U }; j != V::NUMBER_OF_COLS; ++j, sign = -sign)
+                {
+                    det += sign * v.get_element(0U, j) * get_determinant_by_cofactors_of_view(v.get_minor(0U, j));
+                }
+                return det;
+            }
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_cofactor_determinant(std::ostream& out, std::mt19937& gen, std::size_t iterations)
+        {
+            auto const m{ get_random_matrix<M, M, T>(gen) };
+
+            print_section(out, "Matrix<", M, ", ", M, ">");
+            print_result(out, "  copied minors", measure_ns_per_op(iterations, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_determinant_by_cofactors(m) };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  minor views", measure_ns_per_op(iterations, [&m]()
+            {
+                do_not_optimize(m);
+                auto const res{ get_determinant_by_cofactors_of_view(get_view(m)) };
+                do_not_optimize(res);
+            }));
+        }
+
+        template<std::size_t I, std::size_t J, std::size_t B, std::size_t M, typename T>
+        static void set_block(Matrix<M, M, T>& m, Matrix<B, B, T> const& block) noexcept
+        {
+            for (std::size_t i{ 0U }; i != B; ++i)
+            {
+                std::ranges::copy(block.get_row(i), m.get_mutable_row(I * B + i).begin() + J * B);
+            }
+        }
+
+        // 2x2 blocks of BxB matrices
+        template<std::size_t B, typename T>
+        static void benchmark_block_multiplication(std::ostream& out, std::mt19937& gen)
+        {
+            auto const a{ get_random_matrix<2U * B, 2U * B, T>(gen) };
+            auto const b{ get_random_matrix<2U * B, 2U * B, T>(gen) };
+
+            print_section(out, "Matrix<", 2U * B, ", ", 2U * B, "> as 2x2 blocks");
+            print_result(out, "  copied blocks (get_from)", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&a, &b]()
+            {
+                do_not_optimize(a);
+                do_not_optimize(b);
+
+                auto const a00{ get_from<0U, 0U, B - 1U, B - 1U>(a) };
+                auto const a01{ get_from<0U, B, B - 1U, 2U * B - 1U>(a) };
+                auto const a10{ get_from<B, 0U, 2U * B - 1U, B - 1U>(a) };
+                auto const a11{ get_from<B, B, 2U * B - 1U, 2U * B - 1U>(a) };
+                auto const b00{ get_from<0U, 0U, B - 1U, B - 1U>(b) };
+                auto const b01{ get_from<0U, B, B - 1U, 2U * B - 1U>(b) };
+                auto const b10{ get_from<B, 0U, 2U * B - 1U, B - 1U>(b) };
+                auto const b11{ get_from<B, B, 2U * B - 1U, 2U * B - 1U>(b) };
+
+                Matrix<2U * B, 2U * B, T> res{ };
+                set_block<0U, 0U>(res, Matrix<B, B, T>{ a00 * b00 + a01 * b10 });
+                set_block<0U, 1U>(res, Matrix<B, B, T>{ a00 * b01 + a01 * b11 });
+                set_block<1U, 0U>(res, Matrix<B, B, T>{ a10 * b00 + a11 * b10 });
+                set_block<1U, 1U>(res, Matrix<B, B, T>{ a10 * b01 + a11 * b11 });
+                do_not_optimize(res);
+            }));
+            print_result(out, "  block views (get_view_from)", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&a, &b]()
+            {
+                do_not_optimize(a);
+                do_not_optimize(b);
+
+                auto const a00{ get_view_from<0U, 0U, B - 1U, B - 1U>(a) };
+                auto const a01{ get_view_from<0U, B, B - 1U, 2U * B - 1U>(a) };
+                auto const a10{ get_view_from<B, 0U, 2U * B - 1U, B - 1U>(a) };
+                auto const a11{ get_view_from<B, B, 2U * B - 1U, 2U * B - 1U>(a) };
+                auto const b00{ get_view_from<0U, 0U, B - 1U, B - 1U>(b) };
+                auto const b01{ get_view_from<0U, B, B - 1U, 2U * B - 1U>(b) };
+                auto const b10{ get_view_from<B, 0U, 2U * B - 1U, B - 1U>(b) };
+                auto const b11{ get_view_from<B, B, 2U * B - 1U, 2U * B - 1U>(b) };
+
+                Matrix<2U * B, 2U * B, T> res{ };
+                set_block<0U, 0U>(res, Matrix<B, B, T>{ a00 * b00 + a01 * b10 });
+                set_block<0U, 1U>(res, Matrix<B, B, T>{ a00 * b01 + a01 * b11 });
+                set_block<1U, 0U>(res, Matrix<B, B, T>{ a10 * b00 + a11 * b10 });
+                set_block<1U, 1U>(res, Matrix<B, B, T>{ a10 * b01 + a11 * b11 });
+                do_not_optimize(res);
+            }));
+            print_result(out, "  whole matrix", measure_ns_per_op(DEFAULT_ITERATIONS / 10U, [&a, &b]()
+            {
+                do_not_optimize(a);
+                do_not_optimize(b);
+                auto const res{ a * b };
+                do_not_optimize(res);
+            }));
+        }
+
+        // Forward elimination without pivoting, works for any matrix with sum_rows
+        template<std::size_t M, typename R>
+        static void eliminate(R& m)
+        {
+            for (std::size_t I{ 0U }; I + 1U != M; ++I)
+            for (std::size_t i{ I + 1U }; i != M; ++i)
+            {
+                m.sum_rows(I, i, -Views::get_element(m, i, I) / Views::get_element(m, I, I));
+            }
+        }
+
+        template<std::size_t M, typename T>
+        static void benchmark_external_buffer(std::ostream& out, std::mt19937& gen)
+        {
+            // Dominant diagonal keeps pivots far from zero
+            Matrix<M, M, T> source{ get_random_matrix<M, M, T>(gen) };
+            source += get_identity<M, T>() * static_cast<T>(4 * M);
+
+            std::vector<T> const initial(source.get_values().begin(), source.get_values().end());
+            std::vector<T> buffer(initial);
+
+            print_section(out, "Elimination of Matrix<", M, ", ", M, "> stored in std::vector");
+            print_result(out, "  copy to Matrix and back", measure_ns_per_op(DEFAULT_ITERATIONS / 1000U, [&initial, &buffer]()
+            {
+                std::ranges::copy(initial, buffer.begin());
+                do_not_optimize(buffer);
+
+                Matrix<M, M, T> m{ buffer };
+                eliminate<M>(m);
+                std::ranges::copy(m.get_values(), buffer.begin());
+                do_not_optimize(buffer);
+            }));
+            print_result(out, "  in place through MatrixRef", measure_ns_per_op(DEFAULT_ITERATIONS / 1000U, [&initial, &buffer]()
+            {
+                std::ranges::copy(initial, buffer.begin());
+                do_not_optimize(buffer);
+
+                auto m{ get_ref<M, M>(std::span<T>{ buffer }) };
+                eliminate<M>(m);
+                do_not_optimize(buffer);
+            }));
+        }
+
+        // Every vertex {x, y, z, w} of buffer is scaled by its own weight: work is linear, so copying is visible
+        template<std::size_t K, typename T>
+        static void benchmark_vertex_buffer(std::ostream& out, std::mt19937& gen)
+        {
+            std::uniform_real_distribution<T> dist{ static_cast<T>(0.5), static_cast<T>(2) };
+
+            std::vector<T> initial(K * 4U);
+            std::vector<T> weights(K);
+            for (auto& v : initial) v = dist(gen);
+            for (auto& w : weights) w = dist(gen);
+
+            // Buffer is restored before every run, otherwise repeated scaling ends in denormals
+            std::vector<T> buffer(initial);
+
+            print_section(out, "Scaling of ", K, " vertices {x, y, z, w} stored in std::vector");
+            print_result(out, "  copy to Matrix and back", measure_ns_per_op(DEFAULT_ITERATIONS / 1000U, [&initial, &buffer, &weights]()
+            {
+                std::ranges::copy(initial, buffer.begin());
+                do_not_optimize(buffer);
+
+                Matrix<K, 4U, T> m{ buffer };
+                for (std::size_t k{ 0U }; k != K; ++k) m.mul_row(k, weights[k]);
+                std::ranges::copy(m.get_values(), buffer.begin());
+                do_not_optimize(buffer);
+            }));
+            print_result(out, "  in place through MatrixRef", measure_ns_per_op(DEFAULT_ITERATIONS / 1000U, [&initial, &buffer, &weights]()
+            {
+                std::ranges::copy(initial, buffer.begin());
+                do_not_optimize(buffer);
+
+                auto m{ get_ref<K, 4U>(std::span<T>{ buffer }) };
+                for (std::size_t k{ 0U }; k != K; ++k) m.mul_row(k, weights[k]);
+                do_not_optimize(buffer);
+            }));
+        }
+
+        // Everyday operations of Matrix<M, M, T>. Number of iterations falls with size, so every case takes similar time
+        template<std::size_t M, typename T>
+        static void benchmark_basic_operations(std::ostream& out, std::mt19937& gen, std::string_view type_name)
+        {
+            std::size_t const iterations{ std::max(DEFAULT_ITERATIONS / (M * M), std::size_t{ 1'000U }) };
+
+            std::array<T, M * M> values{ };
+            std::ranges::copy(get_random_matrix<M, M, T>(gen).flattern(), values.begin());
+
+            // Dominant diagonal keeps matrix far from singular
+            for (std::size_t i{ 0U }; i != M; ++i)
+            {
+                values[i * M + i] = static_cast<T>(100);
+            }
+
+            Matrix<M, M, T> a{ values };
+            auto b{ get_random_matrix<M, M, T>(gen) };
+
+            print_section(out, "Matrix<", M, ", ", M, ", ", type_name, ">");
+            print_result(out, "  construction from std::array", measure_ns_per_op(iterations, [&values]()
+            {
+                do_not_optimize(values);
+                Matrix<M, M, T> const res{ values };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  copy", measure_ns_per_op(iterations, [&a]()
+            {
+                do_not_optimize(a);
+                Matrix<M, M, T> const res{ a };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  get_transponsed", measure_ns_per_op(iterations, [&a]()
+            {
+                do_not_optimize(a);
+                auto const res{ a.get_transponsed() };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  operator*", measure_ns_per_op(iterations, [&a, &b]()
+            {
+                do_not_optimize(a);
+                do_not_optimize(b);
+                auto const res{ a * b };
+                do_not_optimize(res);
+            }));
+            print_result(out, "  get_determinant", measure_ns_per_op(iterations, [&a]()
+            {
+                do_not_optimize(a);
+                auto const res{ get_determinant(a) };
+                do_not_optimize(res);
+            }));
+
+            if constexpr (std::floating_point<T>)
+            {
+                print_result(out, "  get_inversed", measure_ns_per_op(iterations, [&a]()
+                {
+                    do_not_optimize(a);
+                    auto const res{ get_inversed(a) };
+                    do_not_optimize(res);
+                }));
+            }
+        }
+
+        // Operations of Vector2D over array of K vectors, time is per vector
+        template<typename T, std::size_t K>
+        static void benchmark_vector_operations(std::ostream& out, std::mt19937& gen, std::string_view type_name)
+        {
+            using GameEngine::Geometry::Vector2D;
+
+            static constexpr std::size_t ITERATIONS{ 10'000U };
+
+            std::vector<Vector2D<T>> initial(K);
+            std::vector<Vector2D<T>> other(K);
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                auto const m{ get_random_matrix<1U, 4U, T>(gen) };
+                initial[i] = Vector2D<T>{ m[0][0], m[0][1] };
+                other[i]   = Vector2D<T>{ m[0][2], m[0][3] };
+            }
+
+            std::vector<Vector2D<T>> vectors{ initial };
+            std::vector<double> lengths(K);
+
+            auto const per_vector{ [](double ns_per_op) noexcept { return ns_per_op / static_cast<double>(K); } };
+
+            print_section(out, K, " x Vector2D<", type_name, ">");
+            print_result(out, "  operator+=", per_vector(measure_ns_per_op(ITERATIONS, [&vectors, &other]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) vectors[i] += other[i];
+                do_not_optimize(vectors.front());
+            })));
+            // Buffer is restored every time, otherwise repeated scaling runs into denormals or overflow
+            print_result(out, "  operator* (scalar)", per_vector(measure_ns_per_op(ITERATIONS, [&vectors, &initial]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) vectors[i] = initial[i] * static_cast<T>(3);
+                do_not_optimize(vectors.front());
+            })));
+            print_result(out, "  get_length", per_vector(measure_ns_per_op(ITERATIONS, [&initial, &lengths]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) lengths[i] = initial[i].get_length();
+                do_not_optimize(lengths.front());
+            })));
+
+            if constexpr (std::floating_point<T>)
+            {
+                print_result(out, "  get_normalized", per_vector(measure_ns_per_op(ITERATIONS, [&vectors, &initial]()
+                {
+                    for (std::size_t i{ 0U }; i != K; ++i) vectors[i] = initial[i].get_normalized();
+                    do_not_optimize(vectors.front());
+                })));
+                print_result(out, "  get_rotated", per_vector(measure_ns_per_op(ITERATIONS / 10U, [&vectors, &initial]()
+                {
+                    for (std::size_t i{ 0U }; i != K; ++i) vectors[i] = initial[i].get_rotated(0.3);
+                    do_not_optimize(vectors.front());
+                })));
+            }
+        }
+
+        // Array of Vector2D against Vec2Batch for the same updates of K objects, time is per vector
+        template<std::size_t K>
+        static void benchmark_vec2_batch(std::ostream& out, std::mt19937& gen)
+        {
+            using GameEngine::Geometry::Vector2D;
+            using GameEngine::Geometry::Vec2Batch;
+
+            static constexpr std::size_t ITERATIONS{ 10'000U };
+
+            std::uniform_real_distribution<float> dist{ -100.f, 100.f };
+
+            std::vector<Vector2D<float>> initial(K);
+            std::vector<Vector2D<float>> velocities(K);
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                initial[i]    = Vector2D<float>{ dist(gen), dist(gen) };
+                velocities[i] = Vector2D<float>{ dist(gen), dist(gen) };
+            }
+
+            std::vector<Vector2D<float>> positions{ initial };
+            std::vector<float> lengths(K);
+
+            Vec2Batch<float> const batch_initial{ initial };
+            Vec2Batch<float> const batch_velocities{ velocities };
+            Vec2Batch<float> batch{ batch_initial };
+
+            auto const per_vector{ [](double ns_per_op) noexcept { return ns_per_op / static_cast<double>(K); } };
+
+            print_section(out, "positions += velocities * dt, ", K, " vectors");
+            print_result(out, "  std::vector<Vector2D<float>>", per_vector(measure_ns_per_op(ITERATIONS, [&positions, &velocities]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) positions[i] += velocities[i] * 1e-3f;
+                do_not_optimize(positions.front());
+            })));
+            print_result(out, "  Vec2Batch<float>::add_scaled", per_vector(measure_ns_per_op(ITERATIONS, [&batch, &batch_velocities]()
+            {
+                batch.add_scaled(batch_velocities, 1e-3f);
+                do_not_optimize(batch.get_x().front());
+            })));
+
+            print_section(out, "length, ", K, " vectors");
+            print_result(out, "  Vector2D<float>::get_length", per_vector(measure_ns_per_op(ITERATIONS, [&initial, &lengths]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) lengths[i] = static_cast<float>(initial[i].get_length());
+                do_not_optimize(lengths.front());
+            })));
+            print_result(out, "  Vec2Batch<float>::get_lengths", per_vector(measure_ns_per_op(ITERATIONS, [&batch_initial, &lengths]()
+            {
+                batch_initial.get_lengths(lengths);
+                do_not_optimize(lengths.front());
+            })));
+
+            // Vectors are restored every time, so that normalization and rotation work on the same data
+            print_section(out, "normalize, ", K, " vectors");
+            print_result(out, "  Vector2D<float>::get_normalized", per_vector(measure_ns_per_op(ITERATIONS, [&positions, &initial]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) positions[i] = initial[i].get_normalized();
+                do_not_optimize(positions.front());
+            })));
+            print_result(out, "  Vec2Batch<float>::normalize", per_vector(measure_ns_per_op(ITERATIONS, [&batch, &batch_initial]()
+            {
+                batch = batch_initial;
+                batch.normalize();
+                do_not_optimize(batch.get_x().front());
+            })));
+
+            print_section(out, "rotate, ", K, " vectors");
+            print_result(out, "  Vector2D<float>::get_rotated", per_vector(measure_ns_per_op(ITERATIONS / 10U, [&positions, &initial]()
+            {
+                for (std::size_t i{ 0U }; i != K; ++i) positions[i] = initial[i].get_rotated(0.3);
+                do_not_optimize(positions.front());
+            })));
+            print_result(out, "  Vec2Batch<float>::rotate", per_vector(measure_ns_per_op(ITERATIONS, [&batch, &batch_initial]()
+            {
+                batch = batch_initial;
+                batch.rotate(0.3);
+                do_not_optimize(batch.get_x().front());
+            })));
+
+            print_section(out, "bounding box (min and max), ", K, " vectors");
+            print_result(out, "  loop over std::vector<Vector2D<float>>", per_vector(measure_ns_per_op(ITERATIONS, [&initial]()
+            {
+                Vector2D<float> min{ initial.front() };
+                Vector2D<float> max{ initial.front() };
+                for (auto const& v : initial)
+                {
+                    min = Vector2D<float>{ std::min(min.x, v.x), std::min(min.y, v.y) };
+                    max = Vector2D<float>{ std::max(max.x, v.x), std::max(max.y, v.y) };
+                }
+                do_not_optimize(min);
+                do_not_optimize(max);
+            })));
+            print_result(out, "  Vec2Batch<float>::get_min, get_max", per_vector(measure_ns_per_op(ITERATIONS, [&batch_initial]()
+            {
+                auto const min{ batch_initial.get_min() };
+                auto const max{ batch_initial.get_max() };
+                do_not_optimize(min);
+                do_not_optimize(max);
+            })));
+        }
+    }
+
+    static void run_multiplication_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix multiplication");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_multiplication<3U, float>(out, gen, "float");
+        benchmark_multiplication<4U, float>(out, gen, "float");
+        benchmark_multiplication<3U, double>(out, gen, "double");
+        benchmark_multiplication<4U, double>(out, gen, "double");
+    }
+
+    static void run_expression_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix element-wise expressions");
+
+        std::mt19937 gen{ 42U };
+
+        // Up to MAX_EAGER_ELEMENTS both forms evaluate every step, so only larger sizes gain from fusion
+        benchmark_expression<3U, float>(out, gen, "float");
+        benchmark_expression<4U, float>(out, gen, "float");
+        benchmark_expression<8U, float>(out, gen, "float");
+        benchmark_expression<16U, float>(out, gen, "float");
+        benchmark_expression<3U, double>(out, gen, "double");
+        benchmark_expression<16U, double>(out, gen, "double");
+    }
+
+    static void run_dynamic_multiplication_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Dynamic matrix multiplication");
+
+        std::mt19937 gen{ 42U };
+        GameEngine::Threading::ThreadPool pool{ };
+
+        print_section(out, "Thread pool size: ", pool.get_threads_count());
+
+        benchmark_dynamic_multiplication<double>(out, gen, 64U, 1'000U, true, pool);
+        benchmark_dynamic_multiplication<double>(out, gen, 256U, 20U, true, pool);
+        // Generic product of 1024x1024 matrices takes seconds, so only blocked one is measured
+        benchmark_dynamic_multiplication<double>(out, gen, 1024U, 2U, false, pool);
+    }
+
+    static void run_integral_determinant_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Integral determinant");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_integral_determinant<3U>(out, gen);
+        benchmark_integral_determinant<4U>(out, gen);
+        benchmark_integral_determinant<6U>(out, gen);
+        benchmark_integral_determinant<8U>(out, gen);
+    }
+
+    static void run_small_inverse_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Small matrix determinant and inverse");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_small_inverse<2U, float>(out, gen, "float");
+        benchmark_small_inverse<3U, float>(out, gen, "float");
+        benchmark_small_inverse<4U, float>(out, gen, "float");
+        benchmark_small_inverse<3U, double>(out, gen, "double");
+        benchmark_small_inverse<4U, double>(out, gen, "double");
+    }
+
+    // Shape of StarField: about 1000 stars with 2 * flares vertices each, transformed every frame
+    static void run_vertex_transform_benchmark(std::ostream& out)
+    {
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        print_benchmark_name(out, "Vertex transformation");
+
+        static constexpr std::size_t N_VERTICES{ 1000U * 2U * 10U };
+        static constexpr std::size_t ITERATIONS{ 1'000U };
+
+        std::mt19937 gen{ 42U };
+        std::uniform_real_distribution<float> dist{ -100.f, 100.f };
+
+        std::vector<Vec2f> vertices(N_VERTICES);
+        std::vector<float> x(N_VERTICES);
+        std::vector<float> y(N_VERTICES);
+        for (std::size_t i{ 0U }; i != N_VERTICES; ++i)
+        {
+            vertices[i] = Vec2f{ dist(gen), dist(gen) };
+            x[i] = vertices[i].x;
+            y[i] = vertices[i].y;
+        }
+
+        // Rotation close to identity keeps coordinates bounded over iterations
+        Mat2f const m{ get_scaling(1.f, 1.f) * get_rotation(1e-3f) * get_translation(1e-3f, -1e-3f) };
+        Affine2D const a{ m };
+
+        print_section(out, N_VERTICES, " vertices");
+        print_result(out, "  Matrix<1, 3> * Mat2f per vertex", measure_ns_per_op(ITERATIONS, [&vertices, &m]()
+        {
+            for (auto& vertex : vertices)
+            {
+                apply(vertex, m);
+            }
+            do_not_optimize(vertices.front());
+        }));
+        print_result(out, "  Affine2D per vertex", measure_ns_per_op(ITERATIONS, [&vertices, &a]()
+        {
+            for (auto& vertex : vertices)
+            {
+                vertex = a.apply(vertex);
+            }
+            do_not_optimize(vertices.front());
+        }));
+        print_result(out, "  Affine2D batch, interleaved", measure_ns_per_op(ITERATIONS, [&vertices, &a]()
+        {
+            a.apply(std::span{ vertices });
+            do_not_optimize(vertices.front());
+        }));
+        print_result(out, "  Affine2D batch, separate x and y", measure_ns_per_op(ITERATIONS, [&x, &y, &a]()
+        {
+            a.apply(std::span{ x }, std::span{ y });
+            do_not_optimize(x.front());
+            do_not_optimize(y.front());
+        }));
+
+        using GameEngine::Geometry::Q16_16;
+
+        std::vector<GameEngine::Geometry::Vector2D<Q16_16>> fixed_vertices(vertices.begin(), vertices.end());
+        auto const fixed_m{ get_scaling<Q16_16>(Q16_16{ 1 }, Q16_16{ 1 }) * get_rotation<Q16_16>(1e-3f) * get_translation<Q16_16>(Q16_16{ 1e-3f }, Q16_16{ -1e-3f }) };
+
+        print_result(out, "  Matrix<1, 3> * Matrix<3, 3, Q16_16> per vertex", measure_ns_per_op(ITERATIONS, [&fixed_vertices, &fixed_m]()
+        {
+            for (auto& vertex : fixed_vertices)
+            {
+                apply(vertex, fixed_m);
+            }
+            do_not_optimize(fixed_vertices.front());
+        }));
+    }
+
+    // World matrix of WorldTransformer: translation * uniform scaling * rotation
+    static void run_world_transform_benchmark(std::ostream& out)
+    {
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        print_benchmark_name(out, "World transformation composition");
+
+        Vec2f translation{ 12.f, -7.f };
+        float scaling{ 1.5f };
+        float c{ std::cos(0.3f) };
+        float s{ std::sin(0.3f) };
+
+        print_result(out, "  Mat2f", measure_ns_per_op(DEFAULT_ITERATIONS, [&translation, &scaling, &c, &s]()
+        {
+            do_not_optimize(translation);
+            do_not_optimize(scaling);
+            do_not_optimize(c);
+            do_not_optimize(s);
+            auto const res{ get_translation(translation.x, translation.y) * get_scaling(scaling, scaling) * Mat2f{ std::array{ c, -s, 0.f, s, c, 0.f, 0.f, 0.f, 1.f } } };
+            do_not_optimize(res);
+        }));
+        print_result(out, "  Affine2D", measure_ns_per_op(DEFAULT_ITERATIONS, [&translation, &scaling, &c, &s]()
+        {
+            do_not_optimize(translation);
+            do_not_optimize(scaling);
+            do_not_optimize(c);
+            do_not_optimize(s);
+            auto const res{ Affine2D::get_translation(translation.x, translation.y) * Affine2D::get_scaling(scaling, scaling) * Affine2D{ c, -s, s, c, 0.f, 0.f } };
+            do_not_optimize(res);
+        }));
+        print_result(out, "  Translation * Scaling * Rotation", measure_ns_per_op(DEFAULT_ITERATIONS, [&translation, &scaling, &c, &s]()
+        {
+            do_not_optimize(translation);
+            do_not_optimize(scaling);
+            do_not_optimize(c);
+            do_not_optimize(s);
+            auto const res{ Translation{ translation.x, translation.y } * Scaling{ scaling, scaling } * Rotation{ c, s } };
+            do_not_optimize(res);
+        }));
+    }
+
+    static void run_matrix_chain_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix chain multiplication");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_matrix_chain<Matrix<16U, 16U, float>, Matrix<16U, 16U, float>, Matrix<16U, 16U, float>, Matrix<16U, 1U, float>>(out, gen, "16x16 * 16x16 * 16x16 * 16x1");
+        benchmark_matrix_chain<Matrix<32U, 2U>, Matrix<2U, 32U>, Matrix<32U, 2U>, Matrix<2U, 32U>>(out, gen, "32x2 * 2x32 * 32x2 * 2x32");
+        benchmark_matrix_chain<Matrix<10U, 30U>, Matrix<30U, 5U>, Matrix<5U, 60U>, Matrix<60U, 2U>>(out, gen, "10x30 * 30x5 * 5x60 * 60x2");
+        benchmark_matrix_chain<Matrix<3U, 3U, float>, Matrix<3U, 3U, float>, Matrix<3U, 3U, float>>(out, gen, "3x3 * 3x3 * 3x3");
+    }
+
+    static void run_iteration_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix iteration");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_iteration<4U, float>(out, gen);
+        benchmark_iteration<16U, int>(out, gen);
+        benchmark_iteration<32U, double>(out, gen);
+    }
+
+    static void run_submatrix_view_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Submatrix and minor views");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_cofactor_determinant<5U, double>(out, gen, DEFAULT_ITERATIONS / 10U);
+        benchmark_cofactor_determinant<7U, double>(out, gen, DEFAULT_ITERATIONS / 1000U);
+        benchmark_block_multiplication<8U, float>(out, gen);
+        benchmark_block_multiplication<16U, double>(out, gen);
+    }
+
+    static void run_matrix_batch_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Batched matrix operations");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_matrix_batch<3U, float, 1024U>(out, gen);
+        benchmark_matrix_batch<4U, float, 1024U>(out, gen);
+        benchmark_matrix_batch<3U, double, 1024U>(out, gen);
+    }
+
+    static void run_external_buffer_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix reference to external buffer");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_external_buffer<16U, float>(out, gen);
+        benchmark_external_buffer<64U, double>(out, gen);
+        benchmark_vertex_buffer<2048U, float>(out, gen);
+    }
+
+    static void run_basic_operations_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Matrix basic operations");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_basic_operations<2U, float>(out, gen, "float");
+        benchmark_basic_operations<3U, float>(out, gen, "float");
+        benchmark_basic_operations<4U, float>(out, gen, "float");
+        benchmark_basic_operations<8U, float>(out, gen, "float");
+        benchmark_basic_operations<16U, float>(out, gen, "float");
+        benchmark_basic_operations<2U, double>(out, gen, "double");
+        benchmark_basic_operations<3U, double>(out, gen, "double");
+        benchmark_basic_operations<4U, double>(out, gen, "double");
+        benchmark_basic_operations<8U, double>(out, gen, "double");
+        benchmark_basic_operations<16U, double>(out, gen, "double");
+        benchmark_basic_operations<2U, int>(out, gen, "int");
+        benchmark_basic_operations<3U, int>(out, gen, "int");
+        benchmark_basic_operations<4U, int>(out, gen, "int");
+        benchmark_basic_operations<8U, int>(out, gen, "int");
+    }
+
+    static void run_vector_benchmark(std::ostream& out)
+    {
+        print_benchmark_name(out, "Vector2D operations");
+
+        std::mt19937 gen{ 42U };
+
+        benchmark_vector_operations<float, 4096U>(out, gen, "float");
+        benchmark_vector_operations<double, 4096U>(out, gen, "double");
+        benchmark_vector_operations<int, 4096U>(out, gen, "int");
+        benchmark_vec2_batch<4096U>(out, gen);
+    }
+
+    // Construction of transformation matrices from parameters, as every object does each frame
+    static void run_transformation_helpers_benchmark(std::ostream& out)
+    {
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        print_benchmark_name(out, "Transformations2D helpers");
+
+        float phi{ 0.3f };
+        Vec2f translation{ 12.f, -7.f };
+        Vec2f scaling{ 1.5f, 0.5f };
+
+        print_result(out, "  get_rotation", measure_ns_per_op(DEFAULT_ITERATIONS, [&phi]()
+        {
+            do_not_optimize(phi);
+            auto const res{ get_rotation(phi) };
+            do_not_optimize(res);
+        }));
+        print_result(out, "  get_translation", measure_ns_per_op(DEFAULT_ITERATIONS, [&translation]()
+        {
+            do_not_optimize(translation);
+            auto const res{ get_translation(translation.x, translation.y) };
+            do_not_optimize(res);
+        }));
+        print_result(out, "  get_scaling", measure_ns_per_op(DEFAULT_ITERATIONS, [&scaling]()
+        {
+            do_not_optimize(scaling);
+            auto const res{ get_scaling(scaling.x, scaling.y) };
+            do_not_optimize(res);
+        }));
+        print_result(out, "  get_scaling * get_rotation * get_translation", measure_ns_per_op(DEFAULT_ITERATIONS, [&phi, &translation, &scaling]()
+        {
+            do_not_optimize(phi);
+            do_not_optimize(translation);
+            do_not_optimize(scaling);
+            auto const res{ get_scaling(scaling.x, scaling.y) * get_rotation(phi) * get_translation(translation.x, translation.y) };
+            do_not_optimize(res);
+        }));
+
+        Mat2f const m{ get_scaling(scaling.x, scaling.y) * get_rotation(phi) * get_translation(translation.x, translation.y) };
+        Vec2f vertex{ 1.f, 2.f };
+
+        // Vertex is restored every time, so it doesn't grow with repeated scaling
+        print_result(out, "  apply", measure_ns_per_op(DEFAULT_ITERATIONS, [&m, &vertex]()
+        {
+            do_not_optimize(m);
+            Vec2f res{ vertex };
+            apply(res, m);
+            do_not_optimize(res);
+        }));
+    }
+
+    // Approximations of FastMath against <cmath> over the same K arguments, time is per argument.
+    // Maximum error over these arguments is printed with each pair
+    static void run_fast_math_benchmark(std::ostream& out)
+    {
+        namespace FastMath = GameEngine::Geometry::FastMath;
+        using GameEngine::Geometry::Vector2D;
+
+        print_benchmark_name(out, "Fast math approximations");
+
+        static constexpr std::size_t K{ 4096U };
+        static constexpr std::size_t ITERATIONS{ 2'000U };
+
+        std::mt19937 gen{ 42U };
+        std::uniform_real_distribution<float> positive{ 1e-3f, 1e3f };
+        std::uniform_real_distribution<float> angle{ 0.f, static_cast<float>(2. * std::numbers::pi) };
+
+        std::vector<float> squares(K);
+        std::vector<float> angles(K);
+        std::vector<Vector2D<float>> vectors(K);
+        for (std::size_t i{ 0U }; i != K; ++i)
+        {
+            squares[i] = positive(gen);
+            angles[i]  = angle(gen);
+            vectors[i] = Vector2D<float>{ positive(gen) - 500.f, positive(gen) - 500.f };
+        }
+
+        std::vector<float> res(K);
+        std::vector<float> res_2(K);
+        std::vector<Vector2D<float>> res_vectors(K);
+
+        auto const per_argument{ [](double ns_per_op) noexcept { return ns_per_op / static_cast<double>(K); } };
+
+        double max_error{ 0. };
+        for (float const x : squares) max_error = std::max(max_error, std::abs(static_cast<double>(FastMath::get_rsqrt(x)) * std::sqrt(static_cast<double>(x)) - 1.));
+        print_section(out, "1 / sqrt(x), max relative error ", std::scientific, std::setprecision(2), max_error, std::defaultfloat);
+        print_result(out, "  1.f / std::sqrt", per_argument(measure_ns_per_op(ITERATIONS, [&squares, &res]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res[i] = 1.f / std::sqrt(squares[i]);
+            do_not_optimize(res.front());
+        })));
+        print_result(out, "  FastMath::get_rsqrt", per_argument(measure_ns_per_op(ITERATIONS, [&squares, &res]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res[i] = FastMath::get_rsqrt(squares[i]);
+            do_not_optimize(res.front());
+        })));
+
+        max_error = 0.;
+        for (float const x : angles)
+        {
+            auto const [s, c] { FastMath::get_sincos(x) };
+            max_error = std::max({ max_error, std::abs(s - std::sin(static_cast<double>(x))), std::abs(c - std::cos(static_cast<double>(x))) });
+        }
+        print_section(out, "sin(x) and cos(x), max absolute error ", std::scientific, std::setprecision(2), max_error, std::defaultfloat);
+        print_result(out, "  std::sin, std::cos", per_argument(measure_ns_per_op(ITERATIONS, [&angles, &res, &res_2]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                res[i]   = std::sin(angles[i]);
+                res_2[i] = std::cos(angles[i]);
+            }
+            do_not_optimize(res.front());
+            do_not_optimize(res_2.front());
+        })));
+        print_result(out, "  FastMath::get_sincos", per_argument(measure_ns_per_op(ITERATIONS, [&angles, &res, &res_2]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                auto const [s, c] { FastMath::get_sincos(angles[i]) };
+                res[i]   = s;
+                res_2[i] = c;
+            }
+            do_not_optimize(res.front());
+            do_not_optimize(res_2.front());
+        })));
+
+        max_error = 0.;
+        for (float const x : angles) max_error = std::max(max_error, std::abs(FastMath::get_table_sin(x) - std::sin(static_cast<double>(x))));
+        print_section(out, "sin(x), max absolute error of table ", std::scientific, std::setprecision(2), max_error, std::defaultfloat);
+        print_result(out, "  std::sin", per_argument(measure_ns_per_op(ITERATIONS, [&angles, &res]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res[i] = std::sin(angles[i]);
+            do_not_optimize(res.front());
+        })));
+        print_result(out, "  FastMath::get_table_sin", per_argument(measure_ns_per_op(ITERATIONS, [&angles, &res]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res[i] = FastMath::get_table_sin(angles[i]);
+            do_not_optimize(res.front());
+        })));
+
+        print_section(out, "Vector2D<float>");
+        print_result(out, "  Vector2D::get_normalized", per_argument(measure_ns_per_op(ITERATIONS, [&vectors, &res_vectors]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res_vectors[i] = vectors[i].get_normalized();
+            do_not_optimize(res_vectors.front());
+        })));
+        print_result(out, "  FastMath::get_normalized", per_argument(measure_ns_per_op(ITERATIONS, [&vectors, &res_vectors]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res_vectors[i] = FastMath::get_normalized(vectors[i]);
+            do_not_optimize(res_vectors.front());
+        })));
+        print_result(out, "  Vector2D::get_rotated", per_argument(measure_ns_per_op(ITERATIONS, [&vectors, &angles, &res_vectors]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res_vectors[i] = vectors[i].get_rotated(angles[i]);
+            do_not_optimize(res_vectors.front());
+        })));
+        print_result(out, "  FastMath::get_rotated", per_argument(measure_ns_per_op(ITERATIONS, [&vectors, &angles, &res_vectors]()
+        {
+            for (std::size_t i{ 0U }; i != K; ++i) res_vectors[i] = FastMath::get_rotated(vectors[i], angles[i]);
+            do_not_optimize(res_vectors.front());
+        })));
+    }
+
+    // One box against 10'000 boxes, as ball against bricks of Arkanoid scaled up. Time is per query
+    static void run_rectangle_batch_benchmark(std::ostream& out)
+    {
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::RectangleBatch;
+
+        print_benchmark_name(out, "Batched box collision queries");
+
+        static constexpr std::size_t N_BOXES{ 10'000U };
+        static constexpr std::size_t ITERATIONS{ 10'000U };
+
+        // Boxes of objects are reached through virtual function, as in Collidable
+        struct Box : public GameEngine::Abstract::Collidable
+        {
+            Rectangle2D<int> box;
+
+            explicit Box(Rectangle2D<int> const& init_box) noexcept
+            :
+            box{ init_box }
+            { }
+
+            Rectangle2D<int> get_collision_box() const override
+            {
+                return box;
+            }
+        };
+
+        std::mt19937 gen{ 42U };
+        std::uniform_int_distribution<int> coordinate{ 0, 10'000 };
+
+        std::vector<Rectangle2D<int>> rects{ };
+        std::vector<Box> objects{ };
+        for (std::size_t i{ 0U }; i != N_BOXES; ++i)
+        {
+            int const x{ coordinate(gen) };
+            int const y{ coordinate(gen) };
+            rects.emplace_back(x, x + 20, y + 10, y);
+            objects.emplace_back(rects.back());
+        }
+
+        RectangleBatch<int> const batch{ rects };
+        std::vector<std::uint64_t> mask(batch.get_mask_size());
+
+        std::vector<Rectangle2D<float>> float_rects(rects.begin(), rects.end());
+        RectangleBatch<float> const float_batch{ float_rects };
+
+        // Query out of the field: every box is tested
+        Rectangle2D<int> miss{ -100, -90, -90, -100 };
+        Rectangle2D<float> float_miss{ miss };
+        Rectangle2D<int> hit{ 5'000, 5'400, 5'400, 5'000 };
+
+        print_section(out, N_BOXES, " boxes, first hit (query misses all boxes)");
+        print_result(out, "  find_if, virtual get_collision_box", measure_ns_per_op(ITERATIONS, [&objects, &miss]()
+        {
+            do_not_optimize(miss);
+            auto const it{ std::ranges::find_if(objects, [&miss](Box const& object) { return object.get_collision_box().is_colided_with(miss); }) };
+            do_not_optimize(it);
+        }));
+        print_result(out, "  find_if, Rectangle2D::is_colided_with", measure_ns_per_op(ITERATIONS, [&rects, &miss]()
+        {
+            do_not_optimize(miss);
+            auto const it{ std::ranges::find_if(rects, [&miss](Rectangle2D<int> const& rect) { return rect.is_colided_with(miss); }) };
+            do_not_optimize(it);
+        }));
+        print_result(out, "  RectangleBatch<int>::find_first_collision", measure_ns_per_op(ITERATIONS, [&batch, &miss]()
+        {
+            do_not_optimize(miss);
+            auto const i{ batch.find_first_collision(miss) };
+            do_not_optimize(i);
+        }));
+        print_result(out, "  RectangleBatch<float>::find_first_collision", measure_ns_per_op(ITERATIONS, [&float_batch, &float_miss]()
+        {
+            do_not_optimize(float_miss);
+            auto const i{ float_batch.find_first_collision(float_miss) };
+            do_not_optimize(i);
+        }));
+
+        print_section(out, N_BOXES, " boxes, all hits");
+        print_result(out, "  loop of Rectangle2D::is_colided_with", measure_ns_per_op(ITERATIONS, [&rects, &hit, &mask]()
+        {
+            do_not_optimize(hit);
+            std::ranges::fill(mask, std::uint64_t{ 0U });
+            for (std::size_t i{ 0U }; i != rects.size(); ++i)
+            {
+                mask[i / 64U] |= static_cast<std::uint64_t>(rects[i].is_colided_with(hit)) << (i % 64U);
+            }
+            do_not_optimize(mask.front());
+        }));
+        print_result(out, "  RectangleBatch<int>::get_collisions", measure_ns_per_op(ITERATIONS, [&batch, &hit, &mask]()
+        {
+            do_not_optimize(hit);
+            batch.get_collisions(hit, mask);
+            do_not_optimize(mask.front());
+        }));
+    }
+
+    // Visibility of rotated stars for rotated camera, as Camera::contains of StarField. Time is per star
+    static void run_separating_axis_benchmark(std::ostream& out)
+    {
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::OrientedBox2D;
+        using namespace GameEngine::Geometry::SeparatingAxis;
+
+        print_benchmark_name(out, "Separating axis tests");
+
+        static constexpr std::size_t N_STARS{ 1'000U };
+        static constexpr std::size_t N_VERTICES{ 10U };
+        static constexpr std::size_t ITERATIONS{ 1'000U };
+
+        std::mt19937 gen{ 42U };
+        std::uniform_real_distribution<float> coordinate{ -4'000.f, 4'000.f };
+        std::uniform_real_distribution<float> angle{ 0.f, 2.f * std::numbers::pi_v<float> };
+
+        std::vector<std::vector<Vector2D<float>>> stars(N_STARS);
+        for (auto& star : stars)
+        {
+            Vector2D<float> const center{ coordinate(gen), coordinate(gen) };
+            float const phase{ angle(gen) };
+            for (std::size_t i{ 0U }; i != N_VERTICES; ++i)
+            {
+                float const radius{ (i % 2U == 0U) ? 60.f : 25.f };
+                float const phi{ phase + 2.f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(N_VERTICES) };
+                star.emplace_back(center.x + radius * std::cos(phi), center.y + radius * std::sin(phi));
+            }
+        }
+
+        std::vector<std::vector<Vector2D<float>>> axes{ };
+        std::vector<Vector2D<float>> centers{ };
+        for (auto const& star : stars)
+        {
+            axes.push_back(get_edge_normals(star));
+            centers.push_back(get_mean(star));
+        }
+
+        // Camera as in StarField: area with normal y axis, translated, zoomed and rotated
+        Rectangle2D<float> const camera_area{ -400.f, 400.f, -400.f, 400.f };
+        Vector2D<float> const translation{ 300.f, -200.f };
+        float const scaling{ 1.5f };
+        float const rotation{ 0.6f };
+
+        float const k{ 1.f / scaling };
+        OrientedBox2D const view{ OrientedBox2D::get_from_center(translation + camera_area.get_center().get_rotated(rotation) * k, 400.f * k, 400.f * k, rotation) };
+
+        print_section(out, N_STARS, " stars of ", N_VERTICES, " vertices");
+        print_result(out, "  every vertex to camera space", measure_ns_per_op(ITERATIONS, [&stars, &camera_area, &translation, scaling, rotation]()
+        {
+            std::size_t n_visible{ 0U };
+            for (auto const& star : stars)
+            {
+                n_visible += std::ranges::any_of(star, [&](Vector2D<float> vertex)
+                {
+                    vertex -= translation;
+                    vertex *= scaling;
+                    vertex.rotate(-rotation);
+                    return camera_area.contains_with_normal_y_axis(vertex);
+                });
+            }
+            do_not_optimize(n_visible);
+        }) / static_cast<double>(N_STARS));
+        // New shape every frame, as Star::get_shape gives: normals are computed only for stars near the view
+        print_result(out, "  SAT, axes computed when needed", measure_ns_per_op(ITERATIONS, [&stars, &view]()
+        {
+            std::size_t n_visible{ 0U };
+            for (auto const& star : stars)
+            {
+                if (is_separated_by_box(view, star, get_mean(star))) continue;
+
+                std::vector<Vector2D<float>> const star_axes{ get_edge_normals(star) };
+                n_visible += !is_separated_by_polygon(view, ConvexPolygonView{ star, star_axes, get_mean(star) });
+            }
+            do_not_optimize(n_visible);
+        }) / static_cast<double>(N_STARS));
+        print_result(out, "  SAT, cached axes", measure_ns_per_op(ITERATIONS, [&stars, &axes, &centers, &view]()
+        {
+            std::size_t n_visible{ 0U };
+            for (std::size_t i{ 0U }; i != stars.size(); ++i)
+            {
+                n_visible += is_intersected(view, ConvexPolygonView{ stars[i], axes[i], centers[i] });
+            }
+            do_not_optimize(n_visible);
+        }) / static_cast<double>(N_STARS));
+    }
+
+    static void run_bounding_volumes_benchmark(std::ostream& out)
+    {
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::Transformations2D::Affine2D;
+        using GameEngine::Geometry::get_bounding_box;
+        using GameEngine::Geometry::get_convex_hull;
+
+        print_benchmark_name(out, "Bounding volumes");
+
+        static constexpr std::size_t ITERATIONS{ 1'000U };
+
+        std::mt19937 gen{ 42U };
+        std::uniform_real_distribution<float> coordinate{ -1'000.f, 1'000.f };
+
+        auto const get_scalar_box
+        {
+            [](std::span<Vector2D<float> const> points)
+            {
+                Rectangle2D<float> res{ points.front().x, points.front().x, points.front().y, points.front().y };
+                for (auto const& point : points)
+                {
+                    res.left   = std::min(res.left,   point.x);
+                    res.right  = std::max(res.right,  point.x);
+                    res.top    = std::min(res.top,    point.y);
+                    res.bottom = std::max(res.bottom, point.y);
+                }
+                return res;
+            }
+        };
+
+        for (std::size_t const n : { 10U, 100U, 10'000U })
+        {
+            std::vector<Vector2D<float>> points(n);
+            for (auto& point : points)
+            {
+                point = Vector2D<float>{ coordinate(gen), coordinate(gen) };
+            }
+
+            print_section(out, "bounding box of ", n, " points");
+            print_result(out, "  scalar loop", measure_ns_per_op(ITERATIONS, [&points, &get_scalar_box]()
+            {
+                do_not_optimize(get_scalar_box(points));
+            }));
+            print_result(out, "  vector kernel", measure_ns_per_op(ITERATIONS, [&points]()
+            {
+                do_not_optimize(get_bounding_box(points));
+            }));
+        }
+
+        // Shape rotated every frame: its hull is either computed again or rotated with vertices
+        static constexpr std::size_t N_VERTICES{ 1'000U };
+
+        std::vector<Vector2D<float>> polygon(N_VERTICES);
+        for (auto& vertex : polygon)
+        {
+            vertex = Vector2D<float>{ coordinate(gen), coordinate(gen) };
+        }
+        std::vector<Vector2D<float>> hull{ get_convex_hull(polygon) };
+        Affine2D const rotation{ Affine2D::get_rotation(0.01f) };
+
+        print_section(out, "rotated polygon of ", N_VERTICES, " vertices, hull of ", hull.size());
+        print_result(out, "  hull computed again", measure_ns_per_op(ITERATIONS, [&polygon, &rotation]()
+        {
+            rotation.apply(std::span{ polygon });
+            do_not_optimize(get_convex_hull(polygon));
+        }));
+        print_result(out, "  hull rotated with vertices", measure_ns_per_op(ITERATIONS, [&polygon, &hull, &rotation]()
+        {
+            rotation.apply(std::span{ polygon });
+            rotation.apply(std::span{ hull });
+            do_not_optimize(get_bounding_box(hull));
+        }));
+    }
+
+    static void set_output_format(OutputFormat format) noexcept
+    {
+        report.format = format;
+    }
+
+    // Prints results collected in CSV or JSON format, one record per measured case
+    static void print_report(std::ostream& out)
+    {
+        if (report.format == OutputFormat::CSV)
+        {
+            out << "benchmark,section,name,ns_per_op\n";
+            for (auto const& record : report.records)
+            {
+                print_quoted(out, record.benchmark, false); out << ',';
+                print_quoted(out, record.section, false);   out << ',';
+                print_quoted(out, record.name, false);      out << ',';
+                out << std::fixed << std::setprecision(3) << record.ns_per_op << "\n";
+            }
+        }
+        else if (report.format == OutputFormat::JSON)
+        {
+            out << "{\n";
+            out << "  \"context\": { \"compiler\": "; print_quoted(out, get_compiler_name(), true);
+            out << ", \"build\": \"" << get_build_type() << "\", \"simd\": \"" << get_simd_name() << "\" },\n";
+            out << "  \"results\": [\n";
+            for (std::size_t i{ 0U }; i != report.records.size(); ++i)
+            {
+                auto const& record{ report.records[i] };
+                out << "    { \"benchmark\": "; print_quoted(out, record.benchmark, true);
+                out << ", \"section\": ";     print_quoted(out, record.section, true);
+                out << ", \"name\": ";        print_quoted(out, record.name, true);
+                out << ", \"ns_per_op\": " << std::fixed << std::setprecision(3) << record.ns_per_op;
+                out << (i + 1U != report.records.size() ? " },\n" : " }\n");
+            }
+            out << "  ]\n";
+            out << "}\n";
+        }
+    }
+}
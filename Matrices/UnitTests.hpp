@@ -1,12 +1,42 @@
 #pragma once
 
 #include <Matrix.hpp>
+#include <DynamicMatrix.hpp>
+#include <LUDecomposition.hpp>
+#include <MatrixChain.hpp>
+#include <MatrixViews.hpp>
+#include <MatrixBatch.hpp>
+#include <MatrixRef.hpp>
+#include <Affine2D.hpp>
+#include <StructuredTransforms2D.hpp>
+#include <ConstexprMath.hpp>
+#include <FixedPoint.hpp>
+#include <Rectangle2D.hpp>
+#include <Vec2Batch.hpp>
+#include <FastMath.hpp>
+#include <RectangleBatch.hpp>
+#include <Clipping.hpp>
+#include <SweptCollision.hpp>
+#include <Collidable.hpp>
+#include <OrientedBox2D.hpp>
+#include <SeparatingAxis.hpp>
+#include <BoundingVolumes.hpp>
 
 #include <iostream>
 #include <iomanip>
 #include <string_view>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
+#include <tuple>
+#include <numeric>
+#include <algorithm>
+#include <ranges>
+#include <limits>
+#include <numbers>
+#include <cmath>
+#include <cstdint>
 
 
 namespace UnitTests
@@ -51,6 +81,34 @@ namespace UnitTests
             return out;
         }
 
+        // Has only operators required by arithmetic_like, without compound assignment
+        class DummyOperatorsOnly
+        {
+        public:
+
+            DummyOperatorsOnly() = default;
+            constexpr explicit DummyOperatorsOnly(int value) noexcept : value{ value } {};
+
+            constexpr DummyOperatorsOnly operator+(DummyOperatorsOnly const& rhs) const noexcept { return DummyOperatorsOnly{ value + rhs.value }; }
+            constexpr DummyOperatorsOnly operator-(DummyOperatorsOnly const& rhs) const noexcept { return DummyOperatorsOnly{ value - rhs.value }; }
+            constexpr DummyOperatorsOnly operator*(DummyOperatorsOnly const& rhs) const noexcept { return DummyOperatorsOnly{ value * rhs.value }; }
+            constexpr DummyOperatorsOnly operator/(DummyOperatorsOnly const& rhs) const noexcept { return DummyOperatorsOnly{ value / rhs.value }; }
+
+            friend constexpr bool operator==(DummyOperatorsOnly const&, DummyOperatorsOnly const&) noexcept = default;
+
+            friend std::ostream& operator<<(std::ostream& out, DummyOperatorsOnly const& dummy)
+            {
+                out << dummy.value;
+                return out;
+            }
+
+        private:
+
+            int value{ 0 };
+        };
+        static_assert(arithmetic_like<DummyOperatorsOnly>);
+        static_assert(![]<typename T>(std::type_identity<T>) { return requires (T& lhs, T const& rhs) { lhs += rhs; }; }(std::type_identity<DummyOperatorsOnly>{ }));
+
 
         static void print_test_name(std::ostream& log, std::string_view name)
         {
@@ -59,6 +117,20 @@ namespace UnitTests
             log << SEPARATOR << "\n";
         }
 
+        // One named check of a test, failed check fails the whole test
+        static void report(std::ostream& log, std::ostream& err, bool& passed, std::string_view name, bool is_ok)
+        {
+            if (is_ok)
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << "\n";
+            }
+            else
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] " << name << "\n" << StreamColors::RESET;
+            }
+        }
+
         template<std::size_t M, std::size_t N, typename T>
         constexpr bool is_matrix_constructable()
         {
@@ -71,6 +143,12 @@ namespace UnitTests
             return requires { Matrix<M, N, T>{ std::forward<Args>(args)... }; };
         }
 
+        template<std::size_t M, std::size_t N, typename T, std::size_t K>
+        constexpr bool is_batch_constructable()
+        {
+            return requires { typename MatrixBatch<M, N, T, K>; };
+        }
+
         template<std::size_t M, std::size_t N, typename T, bool is_constructable = is_matrix_constructable<M, N, T>()>
         static void check_invalid_type(std::ostream& log, std::ostream& err, bool& passed)
         {
@@ -811,6 +889,92 @@ namespace UnitTests
         return passed;
     }
 
+    static bool is_pass_linear_iteration_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Matrix linear iteration" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        constexpr Matrix<3U, 4U, int> m{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+        log << "Using matrix:\n";
+        print_matrix(m, log);
+
+        auto const check_cell
+        {
+            [&passed, &log, &err, &m](std::string_view name, std::size_t k, std::size_t row, std::size_t col, int value)
+            {
+                if (row != k / m.NUMBER_OF_COLS || col != k % m.NUMBER_OF_COLS || value != m[row][col])
+                {
+                    passed = false;
+                    err << StreamColors::RED << "[ERROR] " << name << ": wrong cell " << k << "\n" << StreamColors::RESET;
+                }
+                else
+                {
+                    log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+                }
+                log << name << " [" << row << "][" << col << "]:" << value << "\n";
+            }
+        };
+
+        log << "Increment begin\n";
+        {
+            std::size_t k{ 0U };
+            for (auto it{ m.begin() }; it != m.end(); it++, ++k)
+            {
+                check_cell("++", k, it->get_row_index(), it->get_col_index(), it->get_data());
+            }
+        }
+        log << "Increment end\n";
+
+        log << "Decrement begin\n";
+        {
+            std::size_t k{ m.NUMBER_OF_ROWS * m.NUMBER_OF_COLS };
+            for (auto it{ m.end() }; it != m.begin(); )
+            {
+                --it, --k;
+                check_cell("--", k, it->get_row_index(), it->get_col_index(), it->get_data());
+            }
+        }
+        log << "Decrement end\n";
+
+        log << "for_each_cell begin\n";
+        {
+            std::size_t k{ 0U };
+            m.for_each_cell([&check_cell, &k](std::size_t row, std::size_t col, int value)
+            {
+                check_cell("for_each_cell", k++, row, col, value);
+            });
+
+            if (k != m.NUMBER_OF_ROWS * m.NUMBER_OF_COLS)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] for_each_cell visited " << k << " cells\n" << StreamColors::RESET;
+            }
+        }
+        log << "for_each_cell end\n";
+
+        log << "Values begin\n";
+        {
+            std::size_t k{ 0U };
+            for (int const value : m.get_values())
+            {
+                check_cell("get_values", k, k / m.NUMBER_OF_COLS, k % m.NUMBER_OF_COLS, value);
+                ++k;
+            }
+
+            static_assert(std::contiguous_iterator<decltype(m.get_values().begin())>);
+            static_assert([]() { int sum{ 0 }; Matrix<2U, 2U, int>{ 1, 2, 3, 4 }.for_each_cell([&sum](std::size_t i, std::size_t j, int v) { sum += static_cast<int>(i * 10U + j) * v; }); return sum; }() == 0 * 1 + 1 * 2 + 10 * 3 + 11 * 4);
+        }
+        log << "Values end\n";
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
     static bool is_pass_views_test(std::ostream& log, std::ostream& err)
     {
         static constexpr std::string_view TEST_NAME{ "Matrix views" };
@@ -1001,6 +1165,107 @@ namespace UnitTests
         return passed;
     }
 
+    static bool is_pass_strided_views_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Strided matrix views" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        Matrix<3U, 4U, int> m{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+        log << "Using matrix:\n";
+        print_matrix(m, log);
+
+        log << "Stride begin\n";
+        for (std::size_t i{ 0U }; i != m.NUMBER_OF_ROWS; ++i)
+        {
+            if (auto const v{ m.get_row(i) }; v.get_stride() != 1 || v.get_data() != &m[i][0U])
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Row view doesn't point to matrix's row\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "row " << i << " stride: " << v.get_stride() << "\n";
+            }
+        }
+        for (std::size_t j{ 0U }; j != m.NUMBER_OF_COLS; ++j)
+        {
+            if (auto const v{ m.get_col(j) }; v.get_stride() != static_cast<std::ptrdiff_t>(m.NUMBER_OF_COLS) || v.get_data() != &m[0U][j])
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Column view doesn't point to matrix's column\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "column " << j << " stride: " << v.get_stride() << "\n";
+            }
+        }
+        log << "Stride end\n";
+
+        log << "Iterators begin\n";
+        {
+            auto const v{ m.get_col(2U) };
+            auto const it{ v.begin() + 2 };
+
+            if (v.end() - v.begin() != 3 || *it != 10 || it[-1] != 6 || !(v.begin() < it))
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Strided iterator arithmetic is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "column 2: end - begin = " << v.end() - v.begin() << ", *(begin + 2) = " << *it << "\n";
+            }
+
+            if (int const sum{ std::accumulate(v.begin(), v.end(), 0) }; sum != 2 + 6 + 10)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Sum over column view is wrong: " << sum << "\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "sum of column 2: " << sum << "\n";
+            }
+        }
+        log << "Iterators end\n";
+
+        log << "Mutable views begin\n";
+        {
+            auto const row{ m.get_mutable_row(1U) };
+            for (auto& el : row) el *= 10;
+
+            auto const col{ m.get_mutable_col(3U) };
+            col[0U] = -1;
+            std::ranges::fill(col.begin() + 1, col.end(), -2);
+
+            Matrix<3U, 4U, int> const expected{ 0, 1, 2, -1, 40, 50, 60, -2, 8, 9, 10, -2 };
+
+            log << "Result:\n";
+            print_matrix(m, log);
+
+            if (m != expected)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Writing through mutable views is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Writing through mutable views\n";
+            }
+
+            ViewOfMatrix<3U, int> const read_only{ col };
+            check_matrix_and_range(log, err, passed, get_vector_col(read_only), std::array{ -1, -2, -2 });
+        }
+        log << "Mutable views end\n";
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
     static bool is_pass_math_operations_test(std::ostream& log, std::ostream& err)
     {
         static constexpr std::string_view TEST_NAME{ "Math operations" };
@@ -1221,6 +1486,64 @@ namespace UnitTests
         }
         log << "m / " << d << " == m /= " << d << "\n";
 
+        log << "Lazy expressions begin\n";
+        {
+            constexpr Matrix<3U, 3U, int> fused{ m * k + m5 - m6 / d };
+            constexpr std::array check_fused{ 0 * 5, 1 * 5, 2 * 5, 3 * 5, 4 * 5, 5 * 5, 6 * 5, 7 * 5, 8 * 5 };
+
+            log << "m * " << k << " + (m + m) - (m - m) / " << d << ":\n";
+            print_matrix(fused, log);
+
+            check_matrix_and_range(log, err, passed, fused, check_fused);
+
+            M = m;
+            log << "M = m\nM = M + M * " << k << ":\n";
+            M = M + M * k;
+            print_matrix(M, log);
+
+            if (M != m * (k + 1))
+            {
+                passed = false;
+                err << UnitTests::StreamColors::RED << "[ERROR] Matrix is not allowed to be operand of expression assigned to it:\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "M + M * " << k << " == m * " << k + 1 << "\n";
+
+            Matrix<3U, 3U, int> const product{ (m + m) * get_identity<3U, int>() };
+            if (product != m5)
+            {
+                passed = false;
+                err << UnitTests::StreamColors::RED << "[ERROR] Product of lazy expression and matrix is wrong:\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "(m + m) * identity == m + m\n";
+
+            static_assert(std::is_same_v<decltype(m5), Matrix<3U, 3U, int> const>, "Small expression has to be evaluated at once");
+
+            Matrix<5U, 5U, int> const big{ std::views::iota(0, 25) };
+            auto const lazy{ big + big * k };
+            static_assert(!std::is_same_v<std::remove_const_t<decltype(lazy)>, Matrix<5U, 5U, int>>, "Large expression has to stay lazy");
+
+            Matrix<5U, 5U, int> const evaluated{ lazy };
+            if (evaluated != big * (k + 1))
+            {
+                passed = false;
+                err << UnitTests::StreamColors::RED << "[ERROR] Lazy expression of 5x5 matrices is wrong:\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "5x5: big + big * " << k << " == big * " << k + 1 << "\n";
+        }
+        log << "Lazy expressions end\n";
+
         log << "Matrices multiplication begin:\n";
 
         log << "m:\n";
@@ -1324,6 +1647,27 @@ namespace UnitTests
             }
         }
 
+        {
+            const Matrix<3U, 3U, float> M1{ 3.f, 4.f, -2.f, 1.f, 5.f, 8.f, -2.f, 4.f, 5.f };
+            const Matrix<3U, 3U, float> M2{ 6.f, 2.f, 1.f, 3.f, 9.f, -2.f, 2.f, 0.f, 2.f };
+            const Matrix<4U, 4U, float> M3{ 1.f, -2.f, 3.5f, 0.f, 4.f, 0.25f, -1.f, 2.f, 7.f, 3.f, 0.f, -6.f, 2.f, 1.f, 1.f, 1.f };
+            const Matrix<4U, 4U, float> M4{ -3.f, 1.f, 0.5f, 2.f, 1.f, 1.f, 4.f, 0.f, 2.f, -8.f, 1.f, 3.f, 0.f, 5.f, -1.f, 2.f };
+
+            log << "Vectorized kernels " << (Kernels::has_simd_multiply<3U, 3U, 3U, float> ? "enabled" : "disabled") << "\n";
+
+            if (M1 * M2 != multiply_generic(M1, M2) || M3 * M4 != multiply_generic(M3, M4))
+            {
+                passed = false;
+                err << UnitTests::StreamColors::RED << "[ERROR] Vectorized multiplication differs from generic one\n" << StreamColors::RESET;
+                print_matrix(M1 * M2, log);
+                print_matrix(M3 * M4, log);
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] m1 * m2 == multiply_generic(m1, m2) for 3x3 and 4x4 floats\n" << StreamColors::RESET;
+            }
+        }
+
         log << "Matrices multiplication end\n";
 
         if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
@@ -1546,4 +1890,1988 @@ namespace UnitTests
 
         return passed;
     }
+
+    static bool is_pass_dynamic_matrix_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Dynamic matrix" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        constexpr Matrix<2U, 3U, int> m{ 3, 4, -2, 1, 8, -2 };
+        DynamicMatrix<int> const dm{ m };
+
+        if (dm.get_rows_count() != 2U || dm.get_cols_count() != 3U || dm.to_matrix<2U, 3U>() != m)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Conversion between fixed-size and dynamic matrices is wrong\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << "Matrix -> DynamicMatrix -> Matrix\n";
+
+        try
+        {
+            [[maybe_unused]] auto const wrong{ dm.to_matrix<3U, 2U>() };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Conversion to matrix with wrong sizes did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::invalid_argument const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Conversion to matrix with wrong sizes throws\n";
+        }
+
+        constexpr Matrix<3U, 2U, int> m2{ 6, 3, 9, -2, 2, 2 };
+        if ((dm * DynamicMatrix<int>{ m2 }).to_matrix<2U, 2U>() != m * m2)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Dynamic matrices multiplication wrong answer\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << "DynamicMatrix(m1) * DynamicMatrix(m2) == m1 * m2\n";
+
+        {
+            // Sizes are not multiple of block size to check tails of tiles
+            DynamicMatrix<int> a{ 150U, 70U };
+            DynamicMatrix<int> b{ 70U, 131U };
+            for (std::size_t i{ 0U }; i != a.get_rows_count(); ++i)
+            for (std::size_t j{ 0U }; j != a.get_cols_count(); ++j)
+                a(i, j) = static_cast<int>((i * 7U + j * 3U) % 11U) - 5;
+            for (std::size_t i{ 0U }; i != b.get_rows_count(); ++i)
+            for (std::size_t j{ 0U }; j != b.get_cols_count(); ++j)
+                b(i, j) = static_cast<int>((i * 5U + j) % 13U) - 6;
+
+            auto const control{ multiply_generic(a, b) };
+
+            GameEngine::Threading::ThreadPool pool{ 4U };
+            if (multiply_blocked(a, b) != control || multiply_blocked(a, b, &pool) != control)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Blocked multiplication differs from generic one\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "multiply_blocked(a, b) == multiply_generic(a, b) for 150x70 * 70x131 with and without thread pool\n";
+
+            if (a * get_dynamic_identity<int>(70U) != a || get_transponsed(get_transponsed(b)) != b)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Identity or transposition of dynamic matrix is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "a * identity == a && (bT)T == b\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_lu_decomposition_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "LU decomposition" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        // Zero in the top left corner requires pivoting
+        constexpr Matrix<3U> m{ 0., 2., 1., 4., 5., 6., 1., 2., 2. };
+        constexpr double control_d{ -1. };
+        constexpr Matrix<3U> control_inv{ 2., 2., -7., 2., 1., -4., -3., -2., 8. };
+
+        constexpr LUDecomposition lu{ m };
+
+        log << "m:\n";
+        print_matrix(m, log);
+        log << "L:\n";
+        print_matrix(lu.get_lower(), log, 16);
+        log << "U:\n";
+        print_matrix(lu.get_upper(), log, 16);
+
+        if (lu.get_permutation() * m != lu.get_lower() * lu.get_upper())
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] P * A != L * U\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << "P * A == L * U\n";
+
+        constexpr double d{ lu.get_determinant() };
+        if (!GameEngine::Geometry::Auxiliry::is_equal_with_precision(d, control_d) || !GameEngine::Geometry::Auxiliry::is_equal_with_precision(d, get_determinant(m)))
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << d << " == " << control_d << "\n";
+
+        constexpr auto m_inv{ lu.get_inversed() };
+        if (m_inv != control_inv || m_inv * m != get_identity<3U>())
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+            print_matrix(control_inv, log, 16);
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK]" << StreamColors::RESET;
+        }
+        log << "m_inv:\n";
+        print_matrix(m_inv, log, 16);
+
+        constexpr Matrix<3U, 2U> b{ 1., 0., 2., 7., -3., 1. };
+        auto const x{ lu.solve(b) };
+        if (m * x != b || x != m_inv * b)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Solution of linear system is wrong:\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << "m * solve(b) == b for two right-hand sides\n";
+
+        constexpr Matrix<3U> singular{ 1., 2., 3., 2., 4., 6., 0., 1., 1. };
+        LUDecomposition const singular_lu{ singular };
+        if (!singular_lu.is_singular() || singular_lu.get_determinant() != 0.)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Singular matrix is not detected\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Singular matrix has zero determinant\n";
+        }
+
+        try
+        {
+            [[maybe_unused]] auto const wrong{ singular_lu.get_inversed() };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Inversion of singular matrix did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inversion of singular matrix throws\n";
+        }
+
+        // Well-conditioned matrices of small scale are not singular
+        auto const check_scaled
+        {
+            [&log, &err, &passed](std::string_view name, Matrix<3U> const& a, double control)
+            {
+                LUDecomposition const a_lu{ a };
+                bool is_ok{ !a_lu.is_singular() && std::abs(a_lu.get_determinant() / control - 1.) < 1e-12 };
+                if (is_ok)
+                {
+                    auto const inv{ a_lu.get_inversed() };
+                    auto const x{ a_lu.solve(a) };
+                    is_ok = a * inv == get_identity<3U>() && x == get_identity<3U>();
+                }
+                report(log, err, passed, name, is_ok);
+            }
+        };
+        check_scaled("1e-6 * identity is invertible", get_identity<3U>() * 1e-6, 1e-18);
+
+        constexpr Matrix<3U> random{ 0.8147, 0.9134, 0.2785, 0.9058, 0.6324, 0.5469, 0.1270, 0.0975, 0.9575 };
+        check_scaled("1e-6 * random matrix is invertible", random * 1e-6, get_determinant(random) * 1e-18);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_bareiss_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Bareiss algorithm" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        // Zero in the top left corner requires pivoting, integer division by pivots would truncate here
+        constexpr Matrix<3U, 3U, std::int64_t> m1{ std::array<std::int64_t, 9U>{ 0, 2, 1, 4, 5, 6, 1, 2, 2 } };
+        constexpr std::int64_t control_d1{ -1 };
+        constexpr Matrix<3U, 3U, std::int64_t> control_inv1{ std::array<std::int64_t, 9U>{ 2, 2, -7, 2, 1, -4, -3, -2, 8 } };
+
+        constexpr Matrix<4U, 4U, std::int64_t> m2{ std::array<std::int64_t, 16U>{ 2, 3, 1, 5, 6, 13, 5, 19, 2, 19, 10, 23, 4, 10, 11, 31 } };
+        constexpr std::int64_t control_d2{ 24 };
+
+        constexpr Matrix<2U, 2U, std::int64_t> m3{ std::array<std::int64_t, 4U>{ 2, 1, 1, 3 } };
+        constexpr Matrix<2U, 2U, std::int64_t> control_adj3{ std::array<std::int64_t, 4U>{ 3, -1, -1, 2 } };
+
+        log << "m1:\n";
+        print_matrix(m1, log);
+        log << "m2:\n";
+        print_matrix(m2, log);
+
+        constexpr auto d1{ get_determinant(m1) };
+        constexpr auto d2{ get_determinant(m2) };
+        if (d1 != control_d1 || d2 != control_d2 || get_determinant_checked(m1) != control_d1 || get_determinant_checked(m2) != control_d2)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << d1 << " == " << control_d1 << ", " << d2 << " == " << control_d2 << "\n";
+
+        constexpr auto m1_inv{ get_inversed(m1) };
+        if (m1_inv != control_inv1 || get_inversed_checked(m1) != control_inv1 || m1 * m1_inv != get_identity<3U, std::int64_t>())
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+            print_matrix(control_inv1, log);
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK]" << StreamColors::RESET;
+        }
+        log << "m1_inv:\n";
+        print_matrix(m1_inv, log);
+
+        if (get_adjugate(m3) != control_adj3 || get_adjugate(m1) != control_inv1 * control_d1)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Adjugate matrix is wrong\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Adjugate matrix\n";
+        }
+
+        try
+        {
+            [[maybe_unused]] auto const wrong{ get_inversed(m3) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Non integral inverse did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Non integral inverse throws\n";
+        }
+
+        constexpr Matrix<3U, 3U, std::int64_t> singular{ std::array<std::int64_t, 9U>{ 1, 2, 3, 2, 4, 6, 0, 1, 1 } };
+        if (get_determinant(singular) != 0)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Singular matrix has non zero determinant\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Singular matrix has zero determinant\n";
+        }
+
+        try
+        {
+            [[maybe_unused]] auto const wrong{ get_inversed(singular) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Inversion of singular matrix did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inversion of singular matrix throws\n";
+        }
+
+        // Even pivot: numerator of the last step wraps around, but its high bits are a part of the quotient
+        constexpr std::int64_t POWER{ std::int64_t{ 1 } << 32 };
+        constexpr Matrix<3U, 3U, std::int64_t> even_pivot{ std::array<std::int64_t, 9U>{ POWER, 0, 0, 0, 1, 0, 0, 0, 1 } };
+        constexpr Matrix<4U, 4U, std::int64_t> even_pivots{ std::array<std::int64_t, 16U>{ -POWER, 0, 0, 0, 6, 1, 0, 0, 0, 3, 1, 0, 2, 0, 0, -1 } };
+        constexpr Matrix<3U, 3U, std::int32_t> negative_even_pivot{ std::array<std::int32_t, 9U>{ -144, -9, 5, 1, 9, -5, -2, -2, 1 } };
+        if (get_determinant(even_pivot) != POWER || get_determinant(even_pivots) != POWER || get_determinant(negative_even_pivot) != 143)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Determinant with wrapped numerator and even pivot is wrong\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Determinant with wrapped numerator and even pivot\n";
+        }
+
+        constexpr std::int64_t BIG{ 4'000'000'000 };
+        constexpr Matrix<2U, 2U, std::int64_t> huge{ std::array<std::int64_t, 4U>{ BIG, 1, 1, BIG } };
+        try
+        {
+            [[maybe_unused]] auto const wrong{ get_determinant_checked(huge) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Overflow is not detected\n" << StreamColors::RESET;
+        }
+        catch (std::overflow_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Overflow is detected by checked variant\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_closed_form_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Closed form determinant and inverse" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        constexpr Matrix<2U> m2{ 4., 7., 2., 6. };
+        constexpr Matrix<3U> m3{ 0., 2., 1., 4., 5., 6., 1., 2., 2. };
+        constexpr Matrix<4U> m4{ 2., 3., 1., 5., 6., 13., 5., 19., 2., 19., 10., 23., 4., 10., 11., 31. };
+
+        // Evaluated at compile time
+        constexpr double d2{ get_determinant(m2) };
+        constexpr double d3{ get_determinant(m3) };
+        constexpr double d4{ get_determinant(m4) };
+        constexpr auto m2_inv{ get_inversed(m2) };
+        constexpr auto m3_inv{ get_inversed(m3) };
+        constexpr auto m4_inv{ get_inversed(m4) };
+
+        constexpr double control_d2{ 10. };
+        constexpr double control_d3{ -1. };
+        constexpr double control_d4{ 24. };
+        constexpr Matrix<2U> control_inv2{ 0.6, -0.7, -0.2, 0.4 };
+        constexpr Matrix<3U> control_inv3{ 2., 2., -7., 2., 1., -4., -3., -2., 8. };
+
+        for (auto [d, control_d] : { std::pair{ d2, control_d2 }, std::pair{ d3, control_d3 }, std::pair{ d4, control_d4 } })
+        {
+            if (!GameEngine::Geometry::Auxiliry::is_equal_with_precision(d, control_d))
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << d << " == " << control_d << "\n";
+        }
+
+        if (m2_inv != control_inv2 || m3_inv != control_inv3 || m4_inv * m4 != get_identity<4U>() || m4 * m4_inv != get_identity<4U>())
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK]" << StreamColors::RESET;
+        }
+        log << "m4_inv:\n";
+        print_matrix(m4_inv, log, 16);
+
+        if (!GameEngine::Geometry::Auxiliry::is_equal_with_precision(d4, get_determinant_generic(m4)) || m4_inv != get_inversed_generic(m4) || m3_inv != get_inversed_generic(m3))
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Closed form and generic results are not equal\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Closed form and generic results are equal\n";
+        }
+
+        // Determinant is 4e-6, but the matrix is well-conditioned
+        constexpr Matrix<3U, 3U, float> small_scaling{ 0.002f, 0.f, 0.f, 0.f, 0.002f, 0.f, 0.f, 0.f, 1.f };
+        try
+        {
+            if (small_scaling * get_inversed(small_scaling) != get_identity<3U, float>())
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Inverse of small scaling is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inverse of matrix with small determinant\n";
+            }
+        }
+        catch (std::runtime_error const&)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Matrix with small determinant is reported as singular\n" << StreamColors::RESET;
+        }
+
+        constexpr Matrix<4U, 4U, float> singular{ 1.f, 2.f, 3.f, 4.f, 2.f, 4.f, 6.f, 8.f, 0.f, 1.f, 1.f, 0.f, 5.f, 1.f, 0.f, 2.f };
+        try
+        {
+            [[maybe_unused]] auto const wrong{ get_inversed(singular) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Inversion of singular matrix did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inversion of singular matrix throws\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_affine_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Affine 2D transformation" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        auto const m{ get_scaling(2.f, 3.f) * get_rotation(0.7f) * get_translation(5.f, -4.f) };
+        auto const a{ Affine2D::get_scaling(2.f, 3.f) * Affine2D::get_rotation(0.7f) * Affine2D::get_translation(5.f, -4.f) };
+
+        log << "m:\n";
+        print_matrix(m, log);
+
+        if (a.to_matrix() != m || Affine2D{ m } != a)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Composition is not equal to matrix product:\n" << StreamColors::RESET;
+            print_matrix(a.to_matrix(), log);
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Composition is equal to matrix product\n";
+        }
+
+        for (Vec2f const& v : { Vec2f{ 0.f, 0.f }, Vec2f{ 1.f, 0.f }, Vec2f{ -3.5f, 2.25f } })
+        {
+            Vec2f control{ v };
+            apply(control, m);
+
+            auto const res{ a.apply(v) };
+            if (!GameEngine::Geometry::Auxiliry::is_equal_with_precision(res.x, control.x, 1e-4f) || !GameEngine::Geometry::Auxiliry::is_equal_with_precision(res.y, control.y, 1e-4f))
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+            }
+            log << "(" << res.x << ", " << res.y << ") == (" << control.x << ", " << control.y << ")\n";
+        }
+
+        auto const a_inv{ get_inversed(a) };
+        if (a * a_inv != Affine2D{ } || a_inv * a != Affine2D{ } || a_inv.to_matrix() != get_inversed(m))
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Transformation multiplied to its inverse version is not identity\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "a * a_inv == identity\n";
+        }
+
+        // Composition of translation and scaling is computed at compile time
+        constexpr auto ts{ Affine2D::get_translation(1.f, 2.f) * Affine2D::get_scaling(2.f, 4.f) };
+        constexpr auto p{ ts.apply(Vec2f{ 1.f, 1.f }) };
+        if (p.x != 4.f || p.y != 12.f)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET;
+        }
+        log << "(" << p.x << ", " << p.y << ") == (4, 12)\n";
+
+        try
+        {
+            auto const small{ Affine2D::get_scaling(0.002f, 0.002f) };
+            if (small * get_inversed(small) != Affine2D{ })
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Inverse of small scaling is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inverse of small scaling\n";
+            }
+        }
+        catch (std::runtime_error const&)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Small scaling is reported as singular\n" << StreamColors::RESET;
+        }
+
+        try
+        {
+            [[maybe_unused]] auto const wrong{ get_inversed(Affine2D::get_scaling(0.f, 1.f)) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Inversion of singular transformation did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inversion of singular transformation throws\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_batch_transform_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Batch vertex transformation" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        auto const a{ Affine2D::get_scaling(1.5f, 0.5f) * Affine2D::get_rotation(-1.2f) * Affine2D::get_translation(-7.f, 3.f) };
+
+        // Sizes around vector widths check both vector loop and scalar tail
+        for (std::size_t count{ 0U }; count != 20U; ++count)
+        {
+            std::vector<Vec2f> vertices{ };
+            std::vector<float> x{ };
+            std::vector<float> y{ };
+            for (std::size_t i{ 0U }; i != count; ++i)
+            {
+                vertices.emplace_back(static_cast<float>(i) * 0.75f - 3.f, 10.f - static_cast<float>(i * i) * 0.1f);
+                x.push_back(vertices.back().x);
+                y.push_back(vertices.back().y);
+            }
+            auto const original{ vertices };
+
+            a.apply(std::span{ vertices });
+            a.apply(std::span{ x }, std::span{ y });
+
+            // Scalar code may be contracted into FMA, so results are compared up to rounding of the last operation
+            auto const is_near{ [](float lhs, float rhs) { return std::abs(lhs - rhs) <= 1e-5f * (1.f + std::abs(rhs)); } };
+
+            bool equal{ true };
+            for (std::size_t i{ 0U }; i != count; ++i)
+            {
+                auto const control{ a.apply(original[i]) };
+                equal = equal && is_near(vertices[i].x, control.x) && is_near(vertices[i].y, control.y) && is_near(x[i], control.x) && is_near(y[i], control.y);
+            }
+
+            if (!equal)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Batch and per vertex results are not equal for " << count << " vertices\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Batch and per vertex results are equal for " << count << " vertices\n";
+            }
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_structured_transform_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Structured transformations" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using namespace GameEngine::Geometry::Transformations2D;
+
+        Translation const t{ 3.f, -2.f };
+        Scaling const s{ 0.5f, 4.f };
+        Rotation const r{ Rotation::get_from_angle(0.9f) };
+        Affine2D const a{ Affine2D::get_rotation(-0.3f, 2.f) * Affine2D::get_translation(1.f, 7.f) };
+
+        auto const check{ [&log, &err, &passed](std::string_view name, auto const& lhs, auto const& rhs)
+        {
+            auto const composed{ to_affine(lhs * rhs) };
+            Mat2f const control{ to_affine(lhs).to_matrix() * to_affine(rhs).to_matrix() };
+
+            if (composed.to_matrix() != control)
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Composition is not equal to matrix product: " << name << "\n" << StreamColors::RESET;
+                print_matrix(composed.to_matrix(), log);
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << "\n";
+            }
+        } };
+
+        check("translation * translation", t, Translation{ -1.f, 5.f });
+        check("scaling * scaling", s, Scaling{ 3.f, 0.25f });
+        check("rotation * rotation", r, Rotation::get_from_angle(-2.f));
+        check("translation * scaling", t, s);
+        check("scaling * translation", s, t);
+        check("translation * rotation", t, r);
+        check("rotation * translation", r, t);
+        check("scaling * rotation", s, r);
+        check("rotation * scaling", r, s);
+        check("affine * translation", a, t);
+        check("translation * affine", t, a);
+        check("affine * scaling", a, s);
+        check("scaling * affine", s, a);
+        check("affine * rotation", a, r);
+        check("rotation * affine", r, a);
+
+        // Same kinds keep their structure
+        static_assert(std::is_same_v<decltype(t * t), Translation>);
+        static_assert(std::is_same_v<decltype(s * s), Scaling>);
+        static_assert(std::is_same_v<decltype(r * r), Rotation>);
+
+        if ((Rotation::get_from_angle(0.4f) * Rotation::get_from_angle(0.5f)).to_affine() != Rotation::get_from_angle(0.9f).to_affine())
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Composition of rotations is not rotation by sum of angles\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Composition of rotations is rotation by sum of angles\n";
+        }
+
+        Vec2f const v{ 1.5f, -2.5f };
+        for (auto const& [name, res, control] :
+        {
+            std::tuple{ "translation", t.apply(v), t.to_affine().apply(v) },
+            std::tuple{ "scaling", s.apply(v), s.to_affine().apply(v) },
+            std::tuple{ "rotation", r.apply(v), r.to_affine().apply(v) },
+            std::tuple{ "inversed rotation", r.get_inversed().apply(r.apply(v)), v },
+            std::tuple{ "inversed scaling", s.get_inversed().apply(s.apply(v)), v },
+            std::tuple{ "inversed translation", t.get_inversed().apply(t.apply(v)), v }
+        })
+        {
+            if (!GameEngine::Geometry::Auxiliry::is_equal_with_precision(res.x, control.x) || !GameEngine::Geometry::Auxiliry::is_equal_with_precision(res.y, control.y))
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Control and calculated values are not equal: " << name << "\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << ": ";
+            }
+            log << "(" << res.x << ", " << res.y << ") == (" << control.x << ", " << control.y << ")\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_matrix_chain_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Matrix chain multiplication" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        // Textbook examples
+        static_assert(chain_multiplication_cost_v<Matrix<10U, 30U>, Matrix<30U, 5U>, Matrix<5U, 60U>> == 4500U);
+        static_assert(chain_multiplication_cost_v<Matrix<40U, 20U>, Matrix<20U, 30U>, Matrix<30U, 10U>, Matrix<10U, 30U>> == 26000U);
+        static_assert(chain_multiplication_cost_v<Matrix<30U, 35U>, Matrix<35U, 15U>, Matrix<15U, 5U>, Matrix<5U, 10U>, Matrix<10U, 20U>, Matrix<20U, 25U>> == 15125U);
+
+        constexpr Matrix<2U, 3U, int> a{ 1, 2, 3, 4, 5, 6 };
+        constexpr Matrix<3U, 1U, int> b{ 1, -1, 2 };
+        constexpr Matrix<1U, 4U, int> c{ 2, 3, -4, 5 };
+        constexpr Matrix<4U, 2U, int> d{ 1, 0, 0, 1, 1, 1, 2, -3 };
+
+        auto const control{ a * b * c * d };
+        auto const res{ multiply_chain(a, b, c, d) };
+
+        log << "a * b * c * d:\n";
+        print_matrix(res, log);
+
+        if (res != control)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Control and calculated values are not equal:\n" << StreamColors::RESET;
+            print_matrix(control, log);
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Result doesn't depend on parenthesization\n";
+        }
+
+        if (multiply_chain(a, b) != a * b || multiply_chain(b, c) != b * c)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Product of two matrices is wrong\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Product of two matrices\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_submatrix_views_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Submatrix, minor and transposed views" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        Matrix<4U, 5U, int> const m
+        {
+             1,  2,  3,  4,  5,
+             6,  7,  8,  9, 10,
+            11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20
+        };
+
+        log << "Using matrix:\n";
+        print_matrix(m, log);
+
+        auto const check
+        {
+            [&passed, &log, &err](std::string_view name, auto const& view, auto const& control)
+            {
+                auto const materialized{ evaluate(view) };
+                if (materialized != control || !(view == control))
+                {
+                    passed = false;
+                    err << StreamColors::RED << "[ERROR] " << name << " is not equal to copied matrix:\n" << StreamColors::RESET;
+                    print_matrix(materialized, log);
+                    print_matrix(control, log);
+                }
+                else
+                {
+                    log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << ":\n";
+                    print_matrix(materialized, log);
+                }
+            }
+        };
+
+        check("get_view", get_view(m), m);
+        check("get_view_from<1, 2, 3, 3>", get_view_from<1U, 2U, 3U, 3U>(m), get_from<1U, 2U, 3U, 3U>(m));
+        check("get_transponsed_view", get_transponsed_view(m), get_transponsed(m));
+        check("get_minor_view(1, 3)", get_minor_view(m, 1U, 3U), remove_row_and_col(m, 1U, 3U));
+        check("get_minor_view(3, 0).get_minor(0, 2)", get_minor_view(m, 3U, 0U).get_minor(0U, 2U), remove_row_and_col(remove_row_and_col(m, 3U, 0U), 0U, 2U));
+        check("transposed window", get_view_from<0U, 1U, 2U, 4U>(m).get_transponsed(), get_transponsed(get_from<0U, 1U, 2U, 4U>(m)));
+        check("minor of transposed", get_transponsed_view(m).get_minor(4U, 1U), remove_row_and_col(get_transponsed(m), 4U, 1U));
+        check("transposed minor", get_minor_view(m, 2U, 2U).get_transponsed(), get_transponsed(remove_row_and_col(m, 2U, 2U)));
+
+        log << "Operations with views begin\n";
+
+        auto const window{ get_view_from<0U, 0U, 3U, 3U>(m) };
+        auto const square{ get_from<0U, 0U, 3U, 3U>(m) };
+
+        check("window * transposed window", window * get_view_from<0U, 1U, 3U, 4U>(m).get_transponsed(), square * get_transponsed(get_from<0U, 1U, 3U, 4U>(m)));
+        check("matrix * minor", get_from<0U, 0U, 2U, 2U>(m) * get_minor_view(m, 0U, 4U), get_from<0U, 0U, 2U, 2U>(m) * remove_row_and_col(m, 0U, 4U));
+        check("window + matrix", Matrix<4U, 4U, int>{ window + square }, Matrix<4U, 4U, int>{ square * 2 });
+        check("window row", get_vector_row(window.get_row(2U)), get_vector_row(square.get_row(2U)));
+
+        {
+            std::array<DummyOperatorsOnly, 20U> values{ };
+            std::ranges::transform(m.get_values(), values.begin(), [](int value) { return DummyOperatorsOnly{ value }; });
+            Matrix<4U, 5U, DummyOperatorsOnly> const d{ std::move(values) };
+
+            check("window * transposed window without compound assignment", get_view_from<0U, 0U, 3U, 3U>(d) * get_view_from<0U, 1U, 3U, 4U>(d).get_transponsed(),
+                                                                            get_from<0U, 0U, 3U, 3U>(d) * get_transponsed(get_from<0U, 1U, 3U, 4U>(d)));
+        }
+        check("window column", get_vector_col(window.get_transponsed().get_col(1U)), get_vector_col(square.get_row(1U)));
+
+        log << "Operations with views end\n";
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_matrix_batch_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Batched matrix operations" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        // Deterministic matrices with dominant diagonal, so all of them are invertible
+        auto const get_matrices
+        {
+            []<std::size_t M, std::size_t N, typename T, std::size_t K>(std::integral_constant<std::size_t, K>, Matrix<M, N, T> const*)
+            {
+                std::array<Matrix<M, N, T>, K> ms{ };
+                for (std::size_t k{ 0U }; k != K; ++k)
+                {
+                    std::array<T, M * N> data{ };
+                    for (std::size_t e{ 0U }; e != M * N; ++e)
+                    {
+                        data[e] = static_cast<T>(static_cast<int>((e * 7U + k * 13U) % 11U) - 5) + (e / N == e % N ? static_cast<T>(20) : T{ 0 });
+                    }
+                    ms[k] = Matrix<M, N, T>{ std::move(data) };
+                }
+                return ms;
+            }
+        };
+
+        auto const check
+        {
+            [&passed, &log, &err](std::string_view name, auto const& lhs, auto const& rhs)
+            {
+                for (std::size_t k{ 0U }; k != lhs.size(); ++k)
+                {
+                    bool is_equal{ };
+                    if constexpr (std::floating_point<std::remove_cvref_t<decltype(lhs[k])>>) is_equal = GameEngine::Geometry::Auxiliry::is_equal_with_precision(lhs[k], rhs[k]);
+                    else                                                                       is_equal = lhs[k] == rhs[k];
+
+                    if (!is_equal)
+                    {
+                        passed = false;
+                        err << StreamColors::RED << "[ERROR] " << name << ": lane " << k << " differs from per-instance result\n" << StreamColors::RESET;
+                        return;
+                    }
+                }
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << " (" << lhs.size() << " lanes)\n";
+            }
+        };
+
+        auto const check_square
+        {
+            [&check, &get_matrices]<std::size_t M, typename T, std::size_t K>(std::string_view name, Matrix<M, M, T> const* tag, std::integral_constant<std::size_t, K> lanes)
+            {
+                auto const ms{ get_matrices(lanes, tag) };
+                MatrixBatch<M, M, T, K> const batch{ ms };
+
+                auto const batch_det{ get_determinant(batch) };
+
+                // Determinants of 4x4 with dominant diagonal are about 1e5, so they are compared relatively
+                std::array<T, K> ratio{ };
+                std::array<T, K> ones{ };
+                std::array<Matrix<M, M, T>, K> inv{ };
+                std::array<Matrix<M, M, T>, K> sqr{ };
+                for (std::size_t k{ 0U }; k != K; ++k)
+                {
+                    ratio[k] = batch_det[k] / get_determinant(ms[k]);
+                    ones[k] = T{ 1 };
+                    inv[k] = get_inversed(ms[k]);
+                    sqr[k] = ms[k] * ms[k];
+                }
+
+                check(std::string{ name } + " round trip", batch.to_array(), ms);
+                check(std::string{ name } + " determinant", ratio, ones);
+                check(std::string{ name } + " inverse", get_inversed(batch).to_array(), inv);
+                check(std::string{ name } + " product", (batch * batch).to_array(), sqr);
+            }
+        };
+
+        check_square("2x2 float", static_cast<Matrix<2U, 2U, float> const*>(nullptr), std::integral_constant<std::size_t, 40U>{ });
+        check_square("3x3 float", static_cast<Matrix<3U, 3U, float> const*>(nullptr), std::integral_constant<std::size_t, 37U>{ });
+        check_square("4x4 float", static_cast<Matrix<4U, 4U, float> const*>(nullptr), std::integral_constant<std::size_t, 16U>{ });
+        check_square("3x3 double", static_cast<Matrix<3U, 3U, double> const*>(nullptr), std::integral_constant<std::size_t, 5U>{ });
+        check_square("4x4 double", static_cast<Matrix<4U, 4U, double> const*>(nullptr), std::integral_constant<std::size_t, 21U>{ });
+
+        {
+            auto const a{ get_matrices(std::integral_constant<std::size_t, 9U>{ }, static_cast<Matrix<3U, 2U, int> const*>(nullptr)) };
+            auto const b{ get_matrices(std::integral_constant<std::size_t, 9U>{ }, static_cast<Matrix<2U, 4U, int> const*>(nullptr)) };
+
+            std::array<Matrix<3U, 4U, int>, 9U> control{ };
+            for (std::size_t k{ 0U }; k != 9U; ++k) control[k] = a[k] * b[k];
+
+            check("3x2 * 2x4 int product", (MatrixBatch<3U, 2U, int, 9U>{ a } * MatrixBatch<2U, 4U, int, 9U>{ b }).to_array(), control);
+        }
+
+        {
+            // 1024 lanes of 4x4 double take more than 128 KiB
+            constexpr bool is_small_constructable{ is_batch_constructable<4U, 4U, double, 512U>() };
+            constexpr bool is_large_constructable{ is_batch_constructable<4U, 4U, double, 1024U>() };
+            static_assert(Batch::MAX_STORAGE_SIZE == 128U * 1024U, "Sizes of checked batches are chosen for 128 KiB limit");
+
+            report(log, err, passed, "Batch within storage limit is constructable", is_small_constructable);
+            report(log, err, passed, "Batch over storage limit is not constructable", !is_large_constructable);
+        }
+
+        try
+        {
+            std::array<Matrix<3U, 3U, float>, 8U> small{ };
+            small.fill(Matrix<3U, 3U, float>{ 0.002f, 0.f, 0.f, 0.f, 0.002f, 0.f, 0.f, 0.f, 1.f });
+
+            auto const inversed{ get_inversed(MatrixBatch<3U, 3U, float, 8U>{ small }).to_array() };
+            if (small[0U] * inversed[7U] != get_identity<3U, float>())
+            {
+                passed = false;
+                err << StreamColors::RED << "[ERROR] Inverse of batch with small determinants is wrong\n" << StreamColors::RESET;
+            }
+            else
+            {
+                log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inverse of batch with small determinants\n";
+            }
+        }
+        catch (std::runtime_error const&)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Batch with small determinants is reported as singular\n" << StreamColors::RESET;
+        }
+
+        try
+        {
+            auto ms{ get_matrices(std::integral_constant<std::size_t, 20U>{ }, static_cast<Matrix<3U, 3U, float> const*>(nullptr)) };
+            ms[17U] = Matrix<3U, 3U, float>{ 1.f, 2.f, 3.f, 2.f, 4.f, 6.f, 0.f, 1.f, 1.f };
+
+            [[maybe_unused]] auto const wrong{ get_inversed(MatrixBatch<3U, 3U, float, 20U>{ ms }) };
+
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Inversion of batch with singular matrix did not throw\n" << StreamColors::RESET;
+        }
+        catch (std::runtime_error const&)
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Inversion of batch with singular matrix throws\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_matrix_ref_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Matrix reference to external buffer" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        auto const check
+        {
+            [&passed, &log, &err](std::string_view name, auto const& ref, auto const& control)
+            {
+                auto const materialized{ evaluate(ref) };
+                if (materialized != control || !(ref == control))
+                {
+                    passed = false;
+                    err << StreamColors::RED << "[ERROR] " << name << " is not equal to control matrix:\n" << StreamColors::RESET;
+                    print_matrix(materialized, log);
+                    print_matrix(control, log);
+                }
+                else
+                {
+                    log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << name << ":\n";
+                    print_matrix(materialized, log);
+                }
+            }
+        };
+
+        // Four vertices {x, y, z, tag}: positions are 4x3 matrix with row stride 4, tags must stay untouched
+        std::vector<double> buffer
+        {
+            1.0,  2.0,  3.0, -1.0,
+            4.0,  5.0,  6.0, -2.0,
+            7.0,  8.0, 10.0, -3.0,
+            2.0, -1.0,  0.5, -4.0
+        };
+        Matrix<4U, 3U, double> control
+        {
+            1.0,  2.0,  3.0,
+            4.0,  5.0,  6.0,
+            7.0,  8.0, 10.0,
+            2.0, -1.0,  0.5
+        };
+
+        auto positions{ get_ref<4U, 3U>(std::span<double>{ buffer }, 4U) };
+
+        check("get_ref(buffer, 4)", positions, control);
+        check("get_transponsed", positions.get_transponsed(), get_transponsed(control));
+        check("get_from<1, 1, 3, 2>", positions.get_from<1U, 1U, 3U, 2U>(), get_from<1U, 1U, 3U, 2U>(control));
+        check("get_minor(0, 1)", positions.get_minor(0U, 1U), remove_row_and_col(control, 0U, 1U));
+        check("ref * transposed ref", positions * positions.get_transponsed(), control * get_transponsed(control));
+        check("ref + matrix", Matrix<4U, 3U, double>{ positions + control }, Matrix<4U, 3U, double>{ control * 2.0 });
+
+        // Windows taken through constant reference are read-only views
+        constexpr auto is_writable
+        {
+            []<typename R>(std::type_identity<R>)
+            {
+                return requires (R ref, Matrix<3U, 4U, double> const& m)
+                {
+                    ref.template get_from<0U, 0U, 1U, 1U>().get_element(0U, 0U) = 0.0;
+                    ref.get_transponsed().get_element(0U, 0U) = 0.0;
+                    ref.get_transponsed().assign(m);
+                };
+            }
+        };
+        static_assert(!is_writable(std::type_identity<decltype(positions) const&>{ }), "Constant MatrixRef must give read-only views");
+        static_assert(is_writable(std::type_identity<decltype(positions)&>{ }), "Mutable MatrixRef must give mutable views");
+        static_assert(is_writable(std::type_identity<std::remove_cvref_t<decltype(positions)>>{ }), "Copy of MatrixRef is mutable, as copy of std::span");
+
+        check("get_from of constant reference", std::as_const(positions).get_from<1U, 1U, 3U, 2U>(), get_from<1U, 1U, 3U, 2U>(control));
+        check("get_transponsed of constant reference", std::as_const(positions).get_transponsed(), get_transponsed(control));
+
+        positions.swap_rows(0U, 2U).sum_rows(0U, 1U, -0.5).mul_row(3U, 2.0);
+        control.swap_rows(0U, 2U);
+        control.sum_rows(0U, 1U, -0.5).mul_row(3U, 2.0);
+        check("swap_rows, sum_rows, mul_row", positions, control);
+
+        positions.swap_cols(0U, 2U).sum_cols(1U, 0U, 3.0).mul_col(2U, -1.0);
+        control.swap_cols(0U, 2U);
+        control.sum_cols(1U, 0U, 3.0).mul_col(2U, -1.0);
+        check("swap_cols, sum_cols, mul_col", positions, control);
+
+        positions[1U][2U] = 42.0;
+        positions.get_mutable_col(1U)[3U] = -42.0;
+        if (buffer[1U * 4U + 2U] != 42.0 || buffer[3U * 4U + 1U] != -42.0)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Writes through rows and columns don't reach buffer\n" << StreamColors::RESET;
+        }
+
+        // Expression reads the same memory it is written to
+        auto square{ positions.get_from<0U, 0U, 2U, 2U>() };
+        auto const square_before{ evaluate(square) };
+        square.assign(square.get_transponsed());
+        check("assign(transposed of itself)", square, get_transponsed(square_before));
+
+        bool tags_kept{ true };
+        for (std::size_t i{ 0U }; i != 4U; ++i)
+        {
+            tags_kept = tags_kept && buffer[i * 4U + 3U] == -static_cast<double>(i + 1U);
+        }
+        if (!tags_kept)
+        {
+            passed = false;
+            err << StreamColors::RED << "[ERROR] Elements outside of strided reference are changed\n" << StreamColors::RESET;
+        }
+        else
+        {
+            log << StreamColors::GREEN << "[OK] " << StreamColors::RESET << "Elements outside of strided reference are kept\n";
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_constexpr_math_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Compile-time trigonometry and square root" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using namespace GameEngine::Geometry::Transformations2D;
+        namespace ConstexprMath = GameEngine::Geometry::ConstexprMath;
+
+        // Documented bounds: absolute error of sin and cos is not greater than 4.5e-16 for double,
+        // float results are rounded from double, square root is at most 1 ulp away
+        double max_error{ 0.0 };
+        for (int i{ -20'000 }; i <= 20'000; ++i)
+        {
+            double const x{ static_cast<double>(i) * 0.0123 };
+            max_error = std::max({ max_error, std::abs(ConstexprMath::Series::sin(x) - std::sin(x)), std::abs(ConstexprMath::Series::cos(x) - std::cos(x)) });
+        }
+        for (int i{ 0 }; i <= 1'000; ++i)
+        {
+            double const x{ ConstexprMath::MAX_REDUCIBLE_ARGUMENT - static_cast<double>(i) * 997.13 };
+            max_error = std::max({ max_error, std::abs(ConstexprMath::Series::sin(x) - std::sin(x)), std::abs(ConstexprMath::Series::cos(x) - std::cos(x)) });
+        }
+        log << "Max error of sin and cos: " << max_error << "\n";
+        report(log, err, passed, "sin and cos are within 4.5e-16 of <cmath>", max_error <= 4.5e-16);
+
+        bool floats_rounded{ true };
+        for (int i{ -5'000 }; i <= 5'000; ++i)
+        {
+            float const x{ static_cast<float>(i) * 0.00731f };
+            floats_rounded = floats_rounded &&
+                std::abs(ConstexprMath::Series::sin(x) - static_cast<float>(std::sin(static_cast<double>(x)))) <= std::numeric_limits<float>::epsilon() &&
+                std::abs(ConstexprMath::Series::cos(x) - static_cast<float>(std::cos(static_cast<double>(x)))) <= std::numeric_limits<float>::epsilon();
+        }
+        report(log, err, passed, "float sin and cos are rounded from double", floats_rounded);
+
+        bool sqrt_in_ulp{ true };
+        for (double v{ 1e-300 }; v < 1e300; v *= 1.37)
+        {
+            double const expected{ std::sqrt(v) };
+            sqrt_in_ulp = sqrt_in_ulp && std::abs(ConstexprMath::Series::sqrt(v) - expected) <= expected * std::numeric_limits<double>::epsilon();
+        }
+        for (int i{ 0 }; i != 1'000; ++i)
+        {
+            sqrt_in_ulp = sqrt_in_ulp && ConstexprMath::Series::sqrt(static_cast<double>(i * i)) == static_cast<double>(i);
+        }
+        report(log, err, passed, "sqrt is within 1 ulp of <cmath> and exact for perfect squares", sqrt_in_ulp);
+
+        // Values below are computed by compiler
+        static_assert(ConstexprMath::sin(0.0) == 0.0 && ConstexprMath::cos(0.0) == 1.0);
+        static_assert(ConstexprMath::sqrt(2.25f) == 1.5f && ConstexprMath::sqrt(0.0) == 0.0);
+        static_assert(ConstexprMath::sin(std::numbers::pi / 6.0) - 0.5 < 1e-15 && 0.5 - ConstexprMath::sin(std::numbers::pi / 6.0) < 1e-15);
+
+        static constexpr float ANGLE{ static_cast<float>(std::numbers::pi / 3.0) };
+        static constexpr Mat2f ROTATION{ get_rotation(ANGLE, 2.f) };
+        static constexpr Affine2D AFFINE_ROTATION{ Affine2D::get_rotation(ANGLE, 2.f) };
+        static constexpr Rotation STRUCTURED_ROTATION{ Rotation::get_from_angle(ANGLE) };
+        static constexpr Mat2f SCALING{ get_scaling(2.f, 0.5f) };
+        static constexpr Mat2f TRANSLATION{ get_translation(3.f, -1.f) };
+
+        report(log, err, passed, "constexpr get_rotation equals run-time one", ROTATION == get_rotation(ANGLE, 2.f));
+        report(log, err, passed, "constexpr Affine2D::get_rotation equals run-time one", AFFINE_ROTATION.to_matrix() == Affine2D::get_rotation(ANGLE, 2.f).to_matrix());
+        report(log, err, passed, "constexpr Rotation::get_from_angle equals run-time one",
+            GameEngine::Geometry::Auxiliry::is_equal_with_precision(STRUCTURED_ROTATION.c, std::cos(ANGLE)) &&
+            GameEngine::Geometry::Auxiliry::is_equal_with_precision(STRUCTURED_ROTATION.s, std::sin(ANGLE)));
+        report(log, err, passed, "constexpr get_scaling and get_translation equal run-time ones", SCALING == get_scaling(2.f, 0.5f) && TRANSLATION == get_translation(3.f, -1.f));
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_fixed_point_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Fixed-point numbers" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Q16_16;
+        using GameEngine::Geometry::Q16_16Sat;
+        using GameEngine::Geometry::FixedPoint;
+        using GameEngine::Geometry::FixedPointOverflow;
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        namespace Transformations2D = GameEngine::Geometry::Transformations2D;
+
+        // Arithmetic is exact for values representable in Q16.16
+        static_assert(Q16_16{ 1.5 } + Q16_16{ 2.25 } == Q16_16{ 3.75 });
+        static_assert(Q16_16{ 1.5 } - Q16_16{ 2.25 } == Q16_16{ -0.75 });
+        static_assert(Q16_16{ 1.5 } * Q16_16{ -2.25 } == Q16_16{ -3.375 });
+        static_assert(Q16_16{ -3.375 } / Q16_16{ 1.5 } == Q16_16{ -2.25 });
+        static_assert(Q16_16{ 7 }.get_raw() == 7 << 16 && static_cast<int>(Q16_16{ -2.75 }) == -2);
+        static_assert(Q16_16{ 1 } / Q16_16{ 3 } < Q16_16{ 0.3334 } && Q16_16{ 1 } / Q16_16{ 3 } > Q16_16{ 0.3333 });
+
+        report(log, err, passed, "Q16.16 add, subtract, multiply and divide",
+            static_cast<double>(Q16_16{ 12.5 } * Q16_16{ 0.1 }) - 1.25 < 1e-4 &&
+            static_cast<float>(Q16_16{ 100 } / Q16_16{ 8 }) == 12.5f);
+
+        // Overflow policies
+        report(log, err, passed, "Wrapping overflow is modular",
+            Q16_16::get_max() + Q16_16::get_epsilon() == Q16_16::get_min() &&
+            Q16_16{ 32767 } + Q16_16{ 1 } == Q16_16{ -32768 } &&
+            (Q16_16{ 300 } * Q16_16{ 300 }).get_raw() == static_cast<std::int32_t>(static_cast<std::uint32_t>(90000LL << 16)));
+        report(log, err, passed, "Saturating overflow is clamped",
+            Q16_16Sat::get_max() + Q16_16Sat::get_epsilon() == Q16_16Sat::get_max() &&
+            Q16_16Sat{ 300 } * Q16_16Sat{ -300 } == Q16_16Sat::get_min() &&
+            -Q16_16Sat::get_min() == Q16_16Sat::get_max() &&
+            Q16_16Sat{ 1e9 } == Q16_16Sat::get_max() && Q16_16Sat{ 100'000 } == Q16_16Sat::get_max());
+
+        using Q4_4 = FixedPoint<std::int8_t, 4U, FixedPointOverflow::SATURATE>;
+        report(log, err, passed, "Configurable Q4.4 over 8 bits",
+            Q4_4{ 2.5 } * Q4_4{ 1.5 } == Q4_4{ 3.75 } && Q4_4{ 7 } + Q4_4{ 7 } == Q4_4::get_max() && sizeof(Q4_4) == 1U);
+
+        // Vector2D and Rectangle2D
+        Vector2D<Q16_16> v{ Q16_16{ 3 }, Q16_16{ 4 } };
+        report(log, err, passed, "Vector2D<Q16_16> length and arithmetic",
+            v.get_length() == 5.0 &&
+            v * Q16_16{ 0.5 } == Vector2D<Q16_16>{ Q16_16{ 1.5 }, Q16_16{ 2 } } &&
+            v + v - v == v &&
+            Vector2D<float>{ v } == Vector2D<float>{ 3.f, 4.f });
+
+        Rectangle2D<Q16_16> const rect{ Vector2D<Q16_16>{ Q16_16{ 0 }, Q16_16{ 0 } }, Q16_16{ 10 }, Q16_16{ 5 } };
+        Rectangle2D<Q16_16> const other{ Vector2D<Q16_16>{ Q16_16{ 9.5 }, Q16_16{ 4.5 } }, Q16_16{ 1 }, Q16_16{ 1 } };
+        report(log, err, passed, "Rectangle2D<Q16_16> size, center and collision",
+            rect.get_width() == Q16_16{ 10 } && rect.get_height() == Q16_16{ 5 } &&
+            rect.get_center() == Vector2D<Q16_16>{ Q16_16{ 5 }, Q16_16{ 2.5 } } &&
+            rect.is_colided_with(other) && rect.contains(Vector2D<Q16_16>{ Q16_16{ 2 }, Q16_16{ 3 } }));
+
+        // Transformations2D: result is close to float and bit-exact between runs
+        auto const transform
+        {
+            Transformations2D::get_scaling<Q16_16>(Q16_16{ 2 }, Q16_16{ 3 }) *
+            Transformations2D::get_rotation<Q16_16>(0.7f) *
+            Transformations2D::get_translation<Q16_16>(Q16_16{ 5 }, Q16_16{ -4 })
+        };
+        auto const control{ Transformations2D::get_scaling(2.f, 3.f) * Transformations2D::get_rotation(0.7f) * Transformations2D::get_translation(5.f, -4.f) };
+
+        bool close_to_float{ true };
+        bool is_exact{ true };
+        for (int i{ -10 }; i <= 10; ++i)
+        {
+            Vector2D<Q16_16> p{ Q16_16{ i }, Q16_16{ 0.25 * i } };
+            Vector2D<float>  q{ static_cast<float>(i), 0.25f * static_cast<float>(i) };
+            Vector2D<Q16_16> const copy{ p };
+
+            Transformations2D::apply(p, transform);
+            Transformations2D::apply(q, control);
+
+            close_to_float = close_to_float &&
+                GameEngine::Geometry::Auxiliry::is_equal_with_precision(static_cast<float>(p.x), q.x, 1e-3f) &&
+                GameEngine::Geometry::Auxiliry::is_equal_with_precision(static_cast<float>(p.y), q.y, 1e-3f);
+
+            Vector2D<Q16_16> again{ copy };
+            Transformations2D::apply(again, transform);
+            is_exact = is_exact && again.x.get_raw() == p.x.get_raw() && again.y.get_raw() == p.y.get_raw();
+        }
+        report(log, err, passed, "Transformations2D with Q16_16 are within 1e-3 of float", close_to_float);
+        report(log, err, passed, "Transformations2D with Q16_16 are bit-exact", is_exact);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_vec2_batch_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Vec2Batch" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Vec2Batch;
+        using GameEngine::Geometry::Auxiliry::is_equal_with_precision;
+
+        // 37 vectors: full SIMD blocks and scalar tail
+        static constexpr std::size_t K{ 37U };
+
+        std::vector<Vector2D<float>> a(K);
+        std::vector<Vector2D<float>> b(K);
+        for (std::size_t i{ 0U }; i != K; ++i)
+        {
+            float const t{ static_cast<float>(i) };
+            a[i] = Vector2D<float>{ t * 0.5f - 7.f, 3.f - t * 0.25f };
+            b[i] = Vector2D<float>{ t * t * 0.01f, -t };
+        }
+        a[5] = Vector2D<float>{ 0.f, 0.f };
+
+        Vec2Batch<float> const batch_a{ a };
+        Vec2Batch<float> const batch_b{ b };
+
+        auto const is_close
+        {
+            [](Vec2Batch<float> const& batch, auto const& expected, float precision)
+            {
+                bool res{ batch.get_size() == expected.size() };
+                for (std::size_t i{ 0U }; res && i != expected.size(); ++i)
+                {
+                    res = is_equal_with_precision(batch.get_x()[i], expected[i].x, precision) && is_equal_with_precision(batch.get_y()[i], expected[i].y, precision);
+                }
+                return res;
+            }
+        };
+
+        report(log, err, passed, "Conversion to and from std::vector<Vector2D>",
+            batch_a.to_vector() == a && batch_a.get_element(3) == a[3] && batch_a.get_x()[10] == a[10].x && batch_a.get_y()[10] == a[10].y &&
+            reinterpret_cast<std::uintptr_t>(batch_a.get_x().data()) % Vec2Batch<float>::ALIGNMENT == 0U &&
+            reinterpret_cast<std::uintptr_t>(batch_a.get_y().data()) % Vec2Batch<float>::ALIGNMENT == 0U);
+
+        {
+            std::vector<Vector2D<float>> sum(K), difference(K), scaled(K), moved(K), interpolated(K);
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                sum[i]          = a[i] + b[i];
+                difference[i]   = a[i] - b[i];
+                scaled[i]       = a[i] * 3.f;
+                moved[i]        = a[i] + b[i] * 0.1f;
+                interpolated[i] = a[i] + (b[i] - a[i]) * 0.25f;
+            }
+
+            report(log, err, passed, "Add, subtract and scale", (Vec2Batch{ batch_a } += batch_b).to_vector() == sum && (Vec2Batch{ batch_a } -= batch_b).to_vector() == difference && (Vec2Batch{ batch_a } *= 3.f).to_vector() == scaled);
+            report(log, err, passed, "add_scaled and lerp", is_close(Vec2Batch{ batch_a }.add_scaled(batch_b, 0.1f), moved, 1e-5f) && is_close(Vec2Batch{ batch_a }.lerp(batch_b, 0.25f), interpolated, 1e-5f));
+        }
+
+        {
+            std::vector<Vector2D<float>> normalized(K), rotated(K);
+            std::vector<float> lengths(K), dots(K);
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                normalized[i] = a[i].get_normalized();
+                rotated[i]    = a[i].get_rotated(0.7);
+                lengths[i]    = static_cast<float>(a[i].get_length());
+                dots[i]       = a[i].x * b[i].x + a[i].y * b[i].y;
+            }
+
+            std::vector<float> batch_lengths(K), batch_dots(K);
+            batch_a.get_lengths(batch_lengths);
+            batch_a.get_dot(batch_b, batch_dots);
+
+            bool same_scalars{ true };
+            for (std::size_t i{ 0U }; i != K; ++i)
+            {
+                same_scalars = same_scalars && is_equal_with_precision(batch_lengths[i], lengths[i], 1e-5f) && is_equal_with_precision(batch_dots[i], dots[i], 1e-4f);
+            }
+
+            report(log, err, passed, "Normalize keeps zero vector, rotate", is_close(Vec2Batch{ batch_a }.normalize(), normalized, 1e-6f) && Vec2Batch{ batch_a }.normalize().get_element(5) == a[5] && is_close(Vec2Batch{ batch_a }.rotate(0.7), rotated, 1e-5f));
+            report(log, err, passed, "Lengths and dot products", same_scalars);
+        }
+
+        {
+            Vector2D<float> sum{ 0.f, 0.f };
+            Vector2D<float> min{ a[0] };
+            Vector2D<float> max{ a[0] };
+            for (auto const& v : a)
+            {
+                sum += v;
+                min = Vector2D<float>{ std::min(min.x, v.x), std::min(min.y, v.y) };
+                max = Vector2D<float>{ std::max(max.x, v.x), std::max(max.y, v.y) };
+            }
+
+            report(log, err, passed, "Sum, min and max", is_equal_with_precision(batch_a.get_sum().x, sum.x, 1e-4f) && is_equal_with_precision(batch_a.get_sum().y, sum.y, 1e-4f) && batch_a.get_min() == min && batch_a.get_max() == max);
+        }
+
+        // Generic path: the same operations on double and int
+        {
+            std::vector<Vector2D<int>> ints{ { 1, 2 }, { -3, 4 }, { 5, -6 } };
+            Vec2Batch<int> batch{ ints };
+            batch *= 2;
+            batch += Vec2Batch<int>{ 3U, Vector2D<int>{ 1, 1 } };
+
+            std::vector<int> dots(3U);
+            batch.get_dot(batch, dots);
+
+            report(log, err, passed, "Vec2Batch<int>",
+                batch.to_vector() == std::vector<Vector2D<int>>{ { 3, 5 }, { -5, 9 }, { 11, -11 } } &&
+                dots == std::vector<int>{ 34, 106, 242 } && batch.get_sum() == Vector2D<int>{ 9, 3 } &&
+                batch.get_min() == Vector2D<int>{ -5, -11 } && batch.get_max() == Vector2D<int>{ 11, 9 });
+
+            Vec2Batch<double> doubles{ 2U, Vector2D<double>{ 3., 4. } };
+            doubles.normalize().rotate(std::numbers::pi / 2.);
+            report(log, err, passed, "Vec2Batch<double>", is_equal_with_precision(doubles.get_element(1).x, -0.8) && is_equal_with_precision(doubles.get_element(1).y, 0.6));
+        }
+
+        // Empty batch and mismatched sizes
+        {
+            Vec2Batch<float> empty{ };
+            empty.normalize().rotate(1.0);
+
+            bool is_thrown{ false };
+            try
+            {
+                Vec2Batch{ batch_a } += Vec2Batch<float>{ K - 1U };
+            }
+            catch (std::invalid_argument const&)
+            {
+                is_thrown = true;
+            }
+
+            Vec2Batch<float> moved{ batch_a };
+            Vec2Batch<float> const taken{ std::move(moved) };
+            report(log, err, passed, "Empty batch, move and different sizes", empty.is_empty() && empty.get_sum() == Vector2D<float>{ 0.f, 0.f } && taken == batch_a && moved.is_empty() && is_thrown);
+        }
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_fast_math_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Fast math approximations" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        namespace FastMath = GameEngine::Geometry::FastMath;
+        using GameEngine::Geometry::Vector2D;
+
+        // Bounds documented in FastMath.hpp
+#if defined(GAMEENGINE_SIMD_SSE)
+        static constexpr double RSQRT_ERROR{ 3e-7 };
+#else
+        static constexpr double RSQRT_ERROR{ 5e-6 };
+#endif
+        double rsqrt_error{ 0. };
+        for (float x{ 1e-30f }; x < 1e30f; x *= 1.0137f)
+        {
+            rsqrt_error = std::max(rsqrt_error, std::abs(static_cast<double>(FastMath::get_rsqrt(x)) * std::sqrt(static_cast<double>(x)) - 1.));
+        }
+        report(log, err, passed, "get_rsqrt relative error", rsqrt_error <= RSQRT_ERROR);
+
+        double sincos_error{ 0. };
+        for (float x{ -FastMath::MAX_SINCOS_ARGUMENT }; x <= FastMath::MAX_SINCOS_ARGUMENT; x += 0.0517f)
+        {
+            auto const [s, c] { FastMath::get_sincos(x) };
+            sincos_error = std::max({ sincos_error, std::abs(s - std::sin(static_cast<double>(x))), std::abs(c - std::cos(static_cast<double>(x))) });
+        }
+        auto const [big_s, big_c] { FastMath::get_sincos(1e5f) };
+        report(log, err, passed, "get_sincos absolute error", sincos_error <= 2e-7 && big_s == std::sin(1e5f) && big_c == std::cos(1e5f) && FastMath::get_sin(0.f) == 0.f && FastMath::get_cos(0.f) == 1.f);
+
+        double table_error{ 0. };
+        double table_error_period{ 0. };
+        for (float x{ -1000.f }; x <= 1000.f; x += 0.00731f)
+        {
+            double const error{ std::abs(FastMath::get_table_sin(x) - std::sin(static_cast<double>(x))) };
+            table_error = std::max(table_error, error);
+            if (std::abs(x) <= static_cast<float>(2. * std::numbers::pi)) table_error_period = std::max(table_error_period, error);
+        }
+        report(log, err, passed, "get_table_sin absolute error", table_error_period <= 8e-5 && table_error <= 2e-4);
+
+        Vector2D<float> const v{ 3.f, -4.f };
+        Vector2D<float> const normalized{ FastMath::get_normalized(v) };
+        Vector2D<float> const rotated{ FastMath::get_rotated(v, 0.5f) };
+        Vector2D<float> const expected{ v.get_rotated(0.5) };
+        report(log, err, passed, "Vector2D get_normalized and get_rotated",
+            std::abs(normalized.x - 0.6f) <= 5e-6f && std::abs(normalized.y + 0.8f) <= 5e-6f &&
+            FastMath::get_normalized(Vector2D<float>{ 0.f, 0.f }) == Vector2D<float>{ 0.f, 0.f } &&
+            std::abs(rotated.x - expected.x) <= 1e-5f && std::abs(rotated.y - expected.y) <= 1e-5f);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_rectangle_batch_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "RectangleBatch collision queries" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::RectangleBatch;
+
+        // Mask and first hit must agree with Rectangle2D::is_colided_with for every box, including scalar tail
+        auto const is_same_as_per_box
+        {
+            []<typename T>(std::vector<Rectangle2D<T>> const& rects, Rectangle2D<T> const& query)
+            {
+                RectangleBatch<T> const batch{ rects };
+                auto const mask{ batch.get_collisions(query) };
+
+                bool is_same{ mask.size() == (rects.size() + 63U) / 64U };
+                std::size_t first{ rects.size() };
+                for (std::size_t i{ 0U }; i != rects.size(); ++i)
+                {
+                    bool const is_hit{ rects[i].is_colided_with(query) };
+                    if (is_hit && first == rects.size()) first = i;
+                    is_same = is_same && ((mask[i / 64U] >> (i % 64U)) & 1U) == static_cast<std::uint64_t>(is_hit);
+                }
+                return is_same && batch.find_first_collision(query) == first;
+            }
+        };
+
+        std::vector<Rectangle2D<int>> int_rects{ };
+        std::vector<Rectangle2D<float>> float_rects{ };
+        for (int i{ 0 }; i != 139; ++i)
+        {
+            int const x{ (i * 37) % 200 };
+            int const y{ (i * 53) % 150 };
+            int_rects.emplace_back(x, x + 10 + i % 7, y + 8 + i % 5, y);
+            float_rects.emplace_back(static_cast<float>(x) + 0.5f, static_cast<float>(x) + 10.25f, static_cast<float>(y) + 8.75f, static_cast<float>(y));
+        }
+
+        bool is_same_int{ true };
+        bool is_same_float{ true };
+        for (int q{ 0 }; q != 20; ++q)
+        {
+            int const x{ q * 11 - 15 };
+            int const y{ q * 7 - 10 };
+            is_same_int   = is_same_int && is_same_as_per_box(int_rects, Rectangle2D<int>{ x, x + 12, y + 6, y });
+            is_same_float = is_same_float && is_same_as_per_box(float_rects, Rectangle2D<float>{ static_cast<float>(x), static_cast<float>(x) + 12.f, static_cast<float>(y) + 6.f, static_cast<float>(y) });
+        }
+        report(log, err, passed, "int boxes, mask and first hit", is_same_int);
+        report(log, err, passed, "float boxes, mask and first hit", is_same_float);
+
+        // Touching boxes don't collide, as with Rectangle2D::is_colided_with
+        RectangleBatch<int> batch{ };
+        batch.push_back(Rectangle2D<int>{ 0, 10, 10, 0 });
+        batch.push_back(Rectangle2D<int>{ 10, 20, 10, 0 });
+        batch.push_back(Rectangle2D<int>{ 20, 30, 10, 0 });
+        report(log, err, passed, "Touching boxes", batch.find_first_collision(Rectangle2D<int>{ 10, 20, 10, 0 }) == 1U && batch.get_collisions(Rectangle2D<int>{ 10, 20, 10, 0 }) == std::vector<std::uint64_t>{ 0b010U });
+
+        batch.erase(1U);
+        batch.set_element(0U, Rectangle2D<int>{ 100, 110, 10, 0 });
+        report(log, err, passed, "Erase keeps order, set_element",
+            batch.get_size() == 2U && batch.get_element(1U) == Rectangle2D<int>{ 20, 30, 10, 0 } &&
+            batch.find_first_collision(Rectangle2D<int>{ 15, 25, 5, 1 }) == 1U &&
+            batch.find_first_collision(Rectangle2D<int>{ 50, 60, 5, 1 }) == batch.get_size() &&
+            RectangleBatch<int>{ }.find_first_collision(Rectangle2D<int>{ 0, 1, 1, 0 }) == 0U);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_clipping_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Clipping of segments, polygons and polylines" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::Clipping::Segment2D;
+        using GameEngine::Geometry::Clipping::clip_segment;
+        using GameEngine::Geometry::Clipping::clip_polygon;
+        using GameEngine::Geometry::Clipping::clip_polyline;
+
+        using Vec2i = Vector2D<int>;
+        Rectangle2D<int> const area{ 0, 10, 10, 0 };
+
+        auto const is_clipped_to
+        {
+            [](std::optional<Segment2D<int>> const& res, Vec2i const& beg, Vec2i const& end)
+            {
+                return res.has_value() && res->beg == beg && res->end == end;
+            }
+        };
+
+        report(log, err, passed, "Segment inside is unchanged", is_clipped_to(clip_segment(Vec2i{ 2, 3 }, Vec2i{ 7, 8 }, area), Vec2i{ 2, 3 }, Vec2i{ 7, 8 }));
+        report(log, err, passed, "Horizontal segment through area", is_clipped_to(clip_segment(Vec2i{ -5, 5 }, Vec2i{ 15, 5 }, area), Vec2i{ 0, 5 }, Vec2i{ 10, 5 }));
+        report(log, err, passed, "Vertical segment along side", is_clipped_to(clip_segment(Vec2i{ 0, -5 }, Vec2i{ 0, 15 }, area), Vec2i{ 0, 0 }, Vec2i{ 0, 10 }));
+        report(log, err, passed, "Diagonal segment through area", is_clipped_to(clip_segment(Vec2i{ -5, -5 }, Vec2i{ 15, 15 }, area), Vec2i{ 0, 0 }, Vec2i{ 10, 10 }));
+        report(log, err, passed, "Diagonal segment leaving area", is_clipped_to(clip_segment(Vec2i{ 5, 5 }, Vec2i{ 20, 8 }, area), Vec2i{ 5, 5 }, Vec2i{ 10, 6 }));
+        report(log, err, passed, "Area with normal y axis", is_clipped_to(clip_segment(Vec2i{ 15, 15 }, Vec2i{ -5, -5 }, Rectangle2D<int>{ 0, 10, 0, 10 }), Vec2i{ 10, 10 }, Vec2i{ 0, 0 }));
+        report(log, err, passed, "Segment passing by corner is rejected", !clip_segment(Vec2i{ -5, 3 }, Vec2i{ 3, -5 }, area).has_value());
+        report(log, err, passed, "Segment outside is rejected", !clip_segment(Vec2i{ 11, -5 }, Vec2i{ 11, 15 }, area).has_value());
+        report(log, err, passed, "Point segment", is_clipped_to(clip_segment(Vec2i{ 4, 4 }, Vec2i{ 4, 4 }, area), Vec2i{ 4, 4 }, Vec2i{ 4, 4 }) && !clip_segment(Vec2i{ -4, 4 }, Vec2i{ -4, 4 }, area).has_value());
+
+        // Any visible point of segment must survive clipping, and clipped ends must be inside of area on the same line
+        {
+            using Vec2f = Vector2D<float>;
+            Rectangle2D<float> const float_area{ -1.f, 2.f, 1.5f, -0.5f };
+
+            bool is_ok{ true };
+            for (int i{ 0 }; i != 40; ++i)
+            {
+                for (int j{ 0 }; j != 40; ++j)
+                {
+                    Vec2f const beg{ static_cast<float>(i % 8) * 0.7f - 3.f, static_cast<float>(i / 8) * 0.9f - 2.f };
+                    Vec2f const end{ static_cast<float>(j % 5) * 1.3f - 2.5f, static_cast<float>(j / 5) * 0.5f - 1.5f };
+                    auto const res{ clip_segment(beg, end, float_area) };
+
+                    bool is_visible{ false };
+                    for (int k{ 0 }; k <= 100; ++k)
+                    {
+                        float const t{ static_cast<float>(k) / 100.f };
+                        is_visible = is_visible || float_area.contains(Vec2f{ beg.x + (end.x - beg.x) * t, beg.y + (end.y - beg.y) * t });
+                    }
+                    if (is_visible && !res.has_value())
+                    {
+                        is_ok = false;
+                        continue;
+                    }
+                    if (!res.has_value()) continue;
+
+                    for (auto const& point : { res->beg, res->end })
+                    {
+                        float const cross{ (end.x - beg.x) * (point.y - beg.y) - (end.y - beg.y) * (point.x - beg.x) };
+                        is_ok = is_ok && float_area.get_expanded(1e-5f).contains(point) && std::abs(cross) < 1e-4f;
+                    }
+                }
+            }
+            report(log, err, passed, "float segments against brute force", is_ok);
+        }
+
+        auto const get_area
+        {
+            [](std::vector<Vec2i> const& polygon)
+            {
+                int doubled{ 0 };
+                for (std::size_t i{ 0U }; i != polygon.size(); ++i)
+                {
+                    Vec2i const& a{ polygon[i] };
+                    Vec2i const& b{ polygon[(i + 1U) % polygon.size()] };
+                    doubled += a.x * b.y - a.y * b.x;
+                }
+                return std::abs(doubled) / 2.;
+            }
+        };
+
+        std::vector<Vec2i> const inside{ Vec2i{ 1, 1 }, Vec2i{ 9, 2 }, Vec2i{ 5, 8 } };
+        report(log, err, passed, "Polygon inside is unchanged", clip_polygon<int>(inside, area) == inside);
+        report(log, err, passed, "Polygon outside is empty", clip_polygon<int>(std::vector<Vec2i>{ Vec2i{ 11, 1 }, Vec2i{ 19, 2 }, Vec2i{ 15, 8 } }, area).empty());
+
+        auto const covering{ clip_polygon<int>(std::vector<Vec2i>{ Vec2i{ -5, -5 }, Vec2i{ 15, -5 }, Vec2i{ 15, 15 }, Vec2i{ -5, 15 } }, area) };
+        report(log, err, passed, "Polygon covering area becomes area", covering.size() == 4U && get_area(covering) == 100. &&
+            std::ranges::all_of(covering, [](Vec2i const& p) { return (p.x == 0 || p.x == 10) && (p.y == 0 || p.y == 10); }));
+
+        auto const cut{ clip_polygon<int>(std::vector<Vec2i>{ Vec2i{ 0, 0 }, Vec2i{ 15, 0 }, Vec2i{ 0, 15 } }, area) };
+        report(log, err, passed, "Triangle with cut corner", cut.size() == 5U && get_area(cut) == 87.5);
+
+        auto const diamond{ clip_polygon<int>(std::vector<Vec2i>{ Vec2i{ 5, -3 }, Vec2i{ 13, 5 }, Vec2i{ 5, 13 }, Vec2i{ -3, 5 } }, area) };
+        report(log, err, passed, "Diamond crossing every side", diamond.size() == 8U && get_area(diamond) == 100. - 4. * 2. &&
+            std::ranges::all_of(diamond, [&area](Vec2i const& p) { return area.contains(p); }));
+
+        // Polyline leaves area and comes back, so it is split into two runs
+        std::vector<Vec2i> const zigzag{ Vec2i{ -5, 5 }, Vec2i{ 5, 5 }, Vec2i{ 5, -5 }, Vec2i{ 8, -5 }, Vec2i{ 8, 5 }, Vec2i{ 15, 5 } };
+        report(log, err, passed, "Polyline split into runs", clip_polyline<int>(zigzag, area) == std::vector<std::vector<Vec2i>>
+        {
+            { Vec2i{ 0, 5 }, Vec2i{ 5, 5 }, Vec2i{ 5, 0 } },
+            { Vec2i{ 8, 0 }, Vec2i{ 8, 5 }, Vec2i{ 10, 5 } }
+        });
+        report(log, err, passed, "Polyline inside is one run", clip_polyline<int>(inside, area) == std::vector<std::vector<Vec2i>>{ inside });
+        report(log, err, passed, "Polyline outside has no runs", clip_polyline<int>(std::vector<Vec2i>{ Vec2i{ -5, 3 }, Vec2i{ 3, -5 }, Vec2i{ 20, -5 } }, area).empty());
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_swept_collision_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Swept collision and sub-steps" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::Contact;
+        using GameEngine::Geometry::get_swept_contact;
+        using GameEngine::Geometry::get_n_substeps;
+        using GameEngine::Geometry::Auxiliry::is_equal_with_precision;
+
+        using Vec2f = Vector2D<float>;
+        using Rec2i = Rectangle2D<int>;
+
+        auto const is_contact
+        {
+            [](std::optional<Contact> const& contact, float time, Vec2f const& normal)
+            {
+                return contact.has_value() && is_equal_with_precision(contact->time, time, 1e-5f) &&
+                       is_equal_with_precision(contact->normal.x, normal.x, 1e-5f) && is_equal_with_precision(contact->normal.y, normal.y, 1e-5f);
+            }
+        };
+
+        Rec2i const box{ 0, 10, 10, 0 };
+
+        report(log, err, passed, "Box hits left side", is_contact(get_swept_contact(box, Vec2f{ 20.f, 0.f }, Rec2i{ 15, 25, 10, 0 }), 0.25f, Vec2f{ -1.f, 0.f }));
+        report(log, err, passed, "Box hits top side", is_contact(get_swept_contact(box, Vec2f{ 5.f, 40.f }, Rec2i{ -20, 20, 40, 30 }), 0.5f, Vec2f{ 0.f, -1.f }));
+        report(log, err, passed, "Box passes thin obstacle within one step", is_contact(get_swept_contact(box, Vec2f{ 1000.f, 0.f }, Rec2i{ 500, 501, 10, 0 }), 0.49f, Vec2f{ -1.f, 0.f }));
+        report(log, err, passed, "Box overlapping at start", is_contact(get_swept_contact(box, Vec2f{ 20.f, 0.f }, Rec2i{ 5, 25, 10, 0 }), 0.f, Vec2f{ 0.f, 0.f }));
+        report(log, err, passed, "Box only touching at the end", !get_swept_contact(box, Vec2f{ 5.f, 0.f }, Rec2i{ 15, 25, 10, 0 }).has_value());
+        report(log, err, passed, "Box sliding along obstacle", !get_swept_contact(box, Vec2f{ 20.f, 0.f }, Rec2i{ 15, 25, 20, 10 }).has_value());
+        report(log, err, passed, "Box moving away", !get_swept_contact(box, Vec2f{ -20.f, 0.f }, Rec2i{ 15, 25, 10, 0 }).has_value());
+
+        report(log, err, passed, "Circle hits side", is_contact(get_swept_contact(Vec2f{ 0.f, 0.f }, 5.f, Vec2f{ 20.f, 0.f }, Rec2i{ 10, 20, 5, -5 }), 0.25f, Vec2f{ -1.f, 0.f }));
+        report(log, err, passed, "Circle hits corner", is_contact(get_swept_contact(Vec2f{ 0.f, -4.f }, 5.f, Vec2f{ 20.f, 0.f }, Rec2i{ 10, 20, 10, 0 }), 0.35f, Vec2f{ -0.6f, -0.8f }));
+        report(log, err, passed, "Circle misses corner hit by its box",
+            !get_swept_contact(Vec2f{ 0.f, 1.f }, 5.f, Vec2f{ 10.f, -10.f }, Rec2i{ 10, 20, 10, 0 }).has_value() &&
+             get_swept_contact(Rec2i{ -5, 5, 6, -4 }, Vec2f{ 10.f, -10.f }, Rec2i{ 10, 20, 10, 0 }).has_value());
+
+        // Time of the first overlap found by fine sampling of motion must agree with the contact
+        bool is_box_same{ true };
+        bool is_circle_same{ true };
+        for (int i{ 0 }; i != 24; ++i)
+        {
+            for (int j{ 0 }; j != 24; ++j)
+            {
+                Vec2f const displacement{ static_cast<float>(i - 12) * 3.1f, static_cast<float>(j - 12) * 2.7f };
+                Rectangle2D<float> const moving{ -4.f, 4.f, 4.f, -4.f };
+                Rec2i const obstacle{ 3, 20, 25, 8 };
+
+                std::optional<float> box_time{ };
+                std::optional<float> circle_time{ };
+                for (int k{ 0 }; k <= 2000; ++k)
+                {
+                    float const t{ static_cast<float>(k) / 2000.f };
+                    Vec2f const center{ displacement * t };
+
+                    Rectangle2D<float> const at_t{ moving.left + center.x, moving.right + center.x, moving.bottom + center.y, moving.top + center.y };
+                    if (!box_time.has_value() && at_t.is_colided_with(Rectangle2D<float>{ obstacle })) box_time = t;
+
+                    Vec2f const closest{ std::clamp(center.x, 3.f, 20.f), std::clamp(center.y, 8.f, 25.f) };
+                    if (!circle_time.has_value() && (center - closest).get_square_length() < 16.f) circle_time = t;
+                }
+
+                auto const box_contact{ get_swept_contact(moving, displacement, Rectangle2D<float>{ obstacle }) };
+                auto const circle_contact{ get_swept_contact(Vec2f{ 0.f, 0.f }, 4.f, displacement, obstacle) };
+
+                is_box_same = is_box_same && box_contact.has_value() == box_time.has_value() &&
+                    (!box_time.has_value() || std::abs(box_contact->time - *box_time) <= 1e-3f);
+                is_circle_same = is_circle_same && circle_contact.has_value() == circle_time.has_value() &&
+                    (!circle_time.has_value() || std::abs(circle_contact->time - *circle_time) <= 1e-3f);
+            }
+        }
+        report(log, err, passed, "Box contacts against sampled motion", is_box_same);
+        report(log, err, passed, "Circle contacts against sampled motion", is_circle_same);
+
+        struct Box : public GameEngine::Abstract::Collidable
+        {
+            Rec2i box;
+
+            explicit Box(Rec2i const& init_box) noexcept
+            :
+            box{ init_box }
+            { }
+
+            Rec2i get_collision_box() const override
+            {
+                return box;
+            }
+        };
+        report(log, err, passed, "Collidable contact", is_contact(Box{ box }.get_swept_contact(Vec2f{ 0.f, -30.f }, Box{ Rec2i{ 0, 10, -10, -20 } }), 1.f / 3.f, Vec2f{ 0.f, 1.f }));
+
+        report(log, err, passed, "Sub-steps",
+            get_n_substeps(Vec2f{ 400.f, 0.f }, 1.f / 60.f, 8.f) == 1U &&
+            get_n_substeps(Vec2f{ 300.f, 400.f }, 0.5f, 8.f) == 32U &&
+            get_n_substeps(Vec2f{ 400.f, 0.f }, 100.f, 8.f) == 64U &&
+            get_n_substeps(Vec2f{ 0.f, 0.f }, 1.f, 8.f) == 1U);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_separating_axis_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Oriented boxes and separating axis tests" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::OrientedBox2D;
+        using GameEngine::Geometry::SeparatingAxis::ConvexPolygonView;
+        using GameEngine::Geometry::SeparatingAxis::get_edge_normals;
+        using GameEngine::Geometry::SeparatingAxis::get_mean;
+        using GameEngine::Geometry::SeparatingAxis::is_intersected;
+        using GameEngine::Geometry::Auxiliry::is_equal_with_precision;
+
+        using Vec2f = Vector2D<float>;
+
+        auto const is_near
+        {
+            [](Vec2f const& lhs, Vec2f const& rhs)
+            {
+                return is_equal_with_precision(lhs.x, rhs.x, 1e-5f) && is_equal_with_precision(lhs.y, rhs.y, 1e-5f);
+            }
+        };
+
+        float const half_pi{ std::numbers::pi_v<float> / 2.f };
+        float const quarter_pi{ std::numbers::pi_v<float> / 4.f };
+
+        OrientedBox2D const unit{ OrientedBox2D::get_from_rectangle(Rectangle2D<float>{ -1.f, 1.f, -1.f, 1.f }) };
+        OrientedBox2D const turned{ OrientedBox2D::get_from_center(Vec2f{ 3.f, 1.f }, 2.f, 1.f, half_pi) };
+        auto const turned_vertices{ turned.get_vertices() };
+        report(log, err, passed, "Vertices of rotated box", is_near(turned_vertices[0U], Vec2f{ 4.f, -1.f }) && is_near(turned_vertices[1U], Vec2f{ 4.f, 3.f }) &&
+                                          is_near(turned_vertices[2U], Vec2f{ 2.f, 3.f }) && is_near(turned_vertices[3U], Vec2f{ 2.f, -1.f }));
+        report(log, err, passed, "Point inside rotated box", turned.contains(Vec2f{ 3.5f, 2.5f }) && !turned.contains(Vec2f{ 4.5f, 1.f }) && unit.contains(Vec2f{ 1.f, 0.f }));
+
+        auto const diamond_box{ OrientedBox2D::get_from_center(Vec2f{ 0.f, 0.f }, 1.f, 1.f, quarter_pi).get_bounding_box() };
+        report(log, err, passed, "Bounding box of rotated box", is_equal_with_precision(diamond_box.right, std::numbers::sqrt2_v<float>, 1e-5f) && is_equal_with_precision(diamond_box.top, -std::numbers::sqrt2_v<float>, 1e-5f));
+
+        // Bounding boxes of these overlap, but the corner of unit box is in front of the side of rotated one
+        report(log, err, passed, "Rotated boxes near corner", !is_intersected(unit, OrientedBox2D::get_from_center(Vec2f{ 2.f, 2.f }, 1.f, 1.f, quarter_pi)) &&
+                                             is_intersected(unit, OrientedBox2D::get_from_center(Vec2f{ 1.6f, 1.6f }, 1.f, 1.f, quarter_pi)));
+        report(log, err, passed, "Touching boxes", !is_intersected(unit, OrientedBox2D::get_from_rectangle(Rectangle2D<float>{ 1.f, 3.f, -1.f, 1.f })));
+
+        auto const get_view
+        {
+            [](std::vector<Vec2f> const& vertices, std::vector<Vec2f> const& axes)
+            {
+                return ConvexPolygonView{ vertices, axes, get_mean(vertices) };
+            }
+        };
+
+        std::vector<Vec2f> const left_triangle{ Vec2f{ 0.f, 0.f }, Vec2f{ 4.f, 0.f }, Vec2f{ 0.f, 4.f } };
+        std::vector<Vec2f> const right_triangle{ Vec2f{ 4.f, 1.f }, Vec2f{ 4.f, 4.f }, Vec2f{ 1.f, 4.f } };
+        std::vector<Vec2f> const inner_triangle{ Vec2f{ 0.5f, 0.5f }, Vec2f{ 1.f, 0.5f }, Vec2f{ 0.5f, 1.f } };
+        std::vector<Vec2f> const left_axes{ get_edge_normals(left_triangle) };
+        std::vector<Vec2f> const right_axes{ get_edge_normals(right_triangle) };
+        std::vector<Vec2f> const inner_axes{ get_edge_normals(inner_triangle) };
+
+        report(log, err, passed, "Edge normals", left_axes.size() == 3U && is_near(left_axes[0U], Vec2f{ 0.f, 4.f }) && get_edge_normals(std::vector<Vec2f>{ Vec2f{ 1.f, 1.f }, Vec2f{ 1.f, 1.f } }).empty());
+        report(log, err, passed, "Triangles separated by diagonal", !is_intersected(get_view(left_triangle, left_axes), get_view(right_triangle, right_axes)));
+        report(log, err, passed, "Triangle inside triangle", is_intersected(get_view(left_triangle, left_axes), get_view(inner_triangle, inner_axes)));
+
+        // Polygon covering the box has no vertex inside of it, testing vertices one by one misses it
+        std::vector<Vec2f> const cover{ Vec2f{ -10.f, -10.f }, Vec2f{ 10.f, -10.f }, Vec2f{ 0.f, 10.f } };
+        std::vector<Vec2f> const cover_axes{ get_edge_normals(cover) };
+        report(log, err, passed, "Polygon covering box", is_intersected(unit, get_view(cover, cover_axes)) && is_intersected(turned, get_view(cover, cover_axes)));
+        report(log, err, passed, "Box and far polygon", !is_intersected(OrientedBox2D::get_from_center(Vec2f{ 30.f, 0.f }, 2.f, 1.f, 0.3), get_view(cover, cover_axes)));
+
+        // Against exact test of convex polygons: a vertex of one is inside of another or their edges cross
+        auto const get_cross{ [](Vec2f const& a, Vec2f const& b, Vec2f const& p) { return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x); } };
+        auto const is_inside
+        {
+            [&get_cross](std::vector<Vec2f> const& polygon, Vec2f const& p)
+            {
+                bool is_left{ true };
+                bool is_right{ true };
+                for (std::size_t i{ 0U }; i != polygon.size(); ++i)
+                {
+                    float const cross{ get_cross(polygon[i], polygon[(i + 1U) % polygon.size()], p) };
+                    is_left = is_left && cross > 0.f;
+                    is_right = is_right && cross < 0.f;
+                }
+                return is_left || is_right;
+            }
+        };
+        auto const is_crossed
+        {
+            [&get_cross](std::vector<Vec2f> const& lhs, std::vector<Vec2f> const& rhs)
+            {
+                for (std::size_t i{ 0U }; i != lhs.size(); ++i)
+                {
+                    for (std::size_t j{ 0U }; j != rhs.size(); ++j)
+                    {
+                        Vec2f const& a{ lhs[i] };
+                        Vec2f const& b{ lhs[(i + 1U) % lhs.size()] };
+                        Vec2f const& c{ rhs[j] };
+                        Vec2f const& d{ rhs[(j + 1U) % rhs.size()] };
+                        if (get_cross(a, b, c) * get_cross(a, b, d) < 0.f && get_cross(c, d, a) * get_cross(c, d, b) < 0.f) return true;
+                    }
+                }
+                return false;
+            }
+        };
+        auto const get_regular
+        {
+            [](Vec2f const& center, float radius, int n, float phase)
+            {
+                std::vector<Vec2f> res{ };
+                for (int i{ 0 }; i != n; ++i)
+                {
+                    float const angle{ phase + 2.f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(n) };
+                    res.emplace_back(center.x + radius * std::cos(angle), center.y + radius * std::sin(angle));
+                }
+                return res;
+            }
+        };
+
+        bool is_same{ true };
+        int n_intersected{ 0 };
+        for (int i{ 0 }; i != 30; ++i)
+        {
+            for (int j{ 0 }; j != 30; ++j)
+            {
+                std::vector<Vec2f> const lhs{ get_regular(Vec2f{ 0.f, 0.f }, 2.f, 3 + i % 5, 0.1f * static_cast<float>(i)) };
+                std::vector<Vec2f> const rhs{ get_regular(Vec2f{ static_cast<float>(j % 6) * 0.83f - 2.1f, static_cast<float>(j / 6) * 0.91f - 2.3f }, 1.3f, 3 + j % 4, 0.37f * static_cast<float>(j)) };
+                std::vector<Vec2f> const lhs_axes{ get_edge_normals(lhs) };
+                std::vector<Vec2f> const rhs_axes{ get_edge_normals(rhs) };
+
+                bool const is_exact{ is_inside(lhs, rhs.front()) || is_inside(rhs, lhs.front()) || is_crossed(lhs, rhs) };
+                n_intersected += is_exact;
+                is_same = is_same && is_exact == is_intersected(get_view(lhs, lhs_axes), get_view(rhs, rhs_axes));
+
+                // Box is a polygon of its 4 vertices
+                OrientedBox2D const box{ OrientedBox2D::get_from_center(rhs.front(), 1.5f, 0.4f, 0.53 * j) };
+                auto const box_vertices{ box.get_vertices() };
+                std::vector<Vec2f> const box_polygon(box_vertices.begin(), box_vertices.end());
+                bool const is_box_exact{ is_inside(lhs, box_polygon.front()) || is_inside(box_polygon, lhs.front()) || is_crossed(lhs, box_polygon) };
+                is_same = is_same && is_box_exact == is_intersected(box, get_view(lhs, lhs_axes));
+            }
+        }
+        report(log, err, passed, "Polygons against exact test", is_same && n_intersected > 100 && n_intersected < 900);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
+
+    static bool is_pass_bounding_volumes_test(std::ostream& log, std::ostream& err)
+    {
+        static constexpr std::string_view TEST_NAME{ "Bounding boxes, circles and convex hulls" };
+        bool passed{ true };
+
+        print_test_name(log, TEST_NAME);
+
+        using GameEngine::Geometry::Vector2D;
+        using GameEngine::Geometry::Rectangle2D;
+        using GameEngine::Geometry::BoundingCircle;
+        using GameEngine::Geometry::get_bounding_box;
+        using GameEngine::Geometry::get_bounding_circle;
+        using GameEngine::Geometry::get_convex_hull;
+
+        using Vec2f = Vector2D<float>;
+
+        // Deterministic points, every size covers a different split between vector loop and scalar tail
+        auto const get_points
+        {
+            [](std::size_t n)
+            {
+                std::vector<Vec2f> res{ };
+                for (std::size_t i{ 0U }; i != n; ++i)
+                {
+                    float const t{ static_cast<float>(i) };
+                    res.emplace_back(std::sin(t * 1.7f) * 10.f + t * 0.1f, std::cos(t * 2.3f) * 7.f - t * 0.2f);
+                }
+                return res;
+            }
+        };
+
+        bool is_box_exact{ true };
+        for (std::size_t n{ 1U }; n != 40U; ++n)
+        {
+            std::vector<Vec2f> const points{ get_points(n) };
+            Rectangle2D<float> expected{ points.front().x, points.front().x, points.front().y, points.front().y };
+            for (auto const& point : points)
+            {
+                expected.left   = std::min(expected.left,   point.x);
+                expected.right  = std::max(expected.right,  point.x);
+                expected.top    = std::min(expected.top,    point.y);
+                expected.bottom = std::max(expected.bottom, point.y);
+            }
+            Rectangle2D<float> const box{ get_bounding_box(points) };
+            is_box_exact = is_box_exact && box.left == expected.left && box.right == expected.right && box.top == expected.top && box.bottom == expected.bottom;
+        }
+        report(log, err, passed, "Bounding box of 1 to 39 points", is_box_exact);
+
+        std::vector<Vec2f> const points{ get_points(37U) };
+        BoundingCircle const circle{ get_bounding_circle(points, get_bounding_box(points)) };
+        report(log, err, passed, "Bounding circle contains all points", std::ranges::all_of(points, [&circle](Vec2f const& point) { return circle.contains(point); }));
+        report(log, err, passed, "Circles intersection", BoundingCircle{ Vec2f{ 0.f, 0.f }, 1.f }.is_intersected_with(BoundingCircle{ Vec2f{ 1.5f, 0.f }, 1.f }) &&
+                                      !BoundingCircle{ Vec2f{ 0.f, 0.f }, 1.f }.is_intersected_with(BoundingCircle{ Vec2f{ 2.f, 0.f }, 1.f }));
+
+        // Square with points inside, on its sides and repeated corners
+        std::vector<Vec2f> const square
+        {
+            Vec2f{ 1.f, 1.f }, Vec2f{ 0.f, 0.f }, Vec2f{ 2.f, 0.f }, Vec2f{ 0.5f, 1.5f }, Vec2f{ 2.f, 2.f }, Vec2f{ 1.f, 0.f },
+            Vec2f{ 0.f, 2.f }, Vec2f{ 2.f, 1.f }, Vec2f{ 0.f, 0.f }, Vec2f{ 1.f, 2.f }, Vec2f{ 0.f, 1.f }, Vec2f{ 2.f, 2.f }
+        };
+        std::vector<Vec2f> const square_hull{ get_convex_hull(square) };
+        report(log, err, passed, "Hull of square", square_hull == std::vector<Vec2f>{ Vec2f{ 0.f, 0.f }, Vec2f{ 2.f, 0.f }, Vec2f{ 2.f, 2.f }, Vec2f{ 0.f, 2.f } });
+
+        std::vector<Vec2f> const line{ Vec2f{ 2.f, 2.f }, Vec2f{ 0.f, 0.f }, Vec2f{ 1.f, 1.f }, Vec2f{ 3.f, 3.f } };
+        report(log, err, passed, "Hull of collinear points", get_convex_hull(line) == std::vector<Vec2f>{ Vec2f{ 0.f, 0.f }, Vec2f{ 3.f, 3.f } });
+        report(log, err, passed, "Hull of one point", get_convex_hull(std::vector<Vec2f>{ Vec2f{ 1.f, 1.f }, Vec2f{ 1.f, 1.f } }).size() == 1U);
+
+        // Hull is convex, goes counterclockwise and every point is on its inner side
+        std::vector<Vec2f> const hull{ get_convex_hull(points) };
+        bool is_convex{ hull.size() >= 3U };
+        for (std::size_t i{ 0U }; i != hull.size(); ++i)
+        {
+            Vec2f const& a{ hull[i] };
+            Vec2f const& b{ hull[(i + 1U) % hull.size()] };
+            Vec2f const& c{ hull[(i + 2U) % hull.size()] };
+            is_convex = is_convex && (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x) > 0.f;
+            is_convex = is_convex && std::ranges::all_of(points, [&a, &b](Vec2f const& p) { return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x) >= -1e-4f; });
+        }
+        report(log, err, passed, "Hull of points is convex and contains them", is_convex && hull.size() < points.size());
+
+        BoundingCircle const hull_circle{ get_bounding_circle(hull, get_bounding_box(hull)) };
+        report(log, err, passed, "Hull gives the same bounding circle", hull_circle.center == circle.center && hull_circle.radius == circle.radius);
+
+        if (passed) log << UnitTests::StreamColors::GREEN << "[SUCCESS] " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+        else        err << UnitTests::StreamColors::RED   << "[FAIL]    " << TEST_NAME << "\n" << UnitTests::StreamColors::RESET;
+
+        return passed;
+    }
 }
\ No newline at end of file
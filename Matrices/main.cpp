@@ -1,10 +1,83 @@
 #include <iostream>
+#include <string_view>
+#include <array>
+#include <utility>
+#include <cstdlib>
 
 #include "UnitTests.hpp"
+#include "Benchmarks.hpp"
 
 
-int main()
+// Outside of Visual Studio it is built with any C++20 compiler, the only include directory is GameEngine:
+//     g++ -std=c++20 -O2 -DNDEBUG -march=native -I GameEngine Matrices/main.cpp -o matrices
+//     ./matrices                                      runs unit tests
+//     ./matrices --benchmark [--format=text|csv|json] [--filter=<part of benchmark name>]
+// CSV and JSON reports are printed to standard output after all selected benchmarks are finished
+static int run_benchmarks(int argc, char* argv[])
 {
+    using Benchmark = void (*)(std::ostream&);
+
+    static constexpr std::array<std::pair<std::string_view, Benchmark>, 19U> BENCHMARKS
+    {{
+        { "basic_operations",       &Benchmarks::run_basic_operations_benchmark },
+        { "multiplication",         &Benchmarks::run_multiplication_benchmark },
+        { "expression",             &Benchmarks::run_expression_benchmark },
+        { "dynamic_multiplication", &Benchmarks::run_dynamic_multiplication_benchmark },
+        { "integral_determinant",   &Benchmarks::run_integral_determinant_benchmark },
+        { "small_inverse",          &Benchmarks::run_small_inverse_benchmark },
+        { "vector",                 &Benchmarks::run_vector_benchmark },
+        { "transformation_helpers", &Benchmarks::run_transformation_helpers_benchmark },
+        { "fast_math",              &Benchmarks::run_fast_math_benchmark },
+        { "rectangle_batch",        &Benchmarks::run_rectangle_batch_benchmark },
+        { "separating_axis",        &Benchmarks::run_separating_axis_benchmark },
+        { "bounding_volumes",       &Benchmarks::run_bounding_volumes_benchmark },
+        { "vertex_transform",       &Benchmarks::run_vertex_transform_benchmark },
+        { "world_transform",        &Benchmarks::run_world_transform_benchmark },
+        { "matrix_chain",           &Benchmarks::run_matrix_chain_benchmark },
+        { "submatrix_view",         &Benchmarks::run_submatrix_view_benchmark },
+        { "iteration",              &Benchmarks::run_iteration_benchmark },
+        { "matrix_batch",           &Benchmarks::run_matrix_batch_benchmark },
+        { "external_buffer",        &Benchmarks::run_external_buffer_benchmark }
+    }};
+
+    std::string_view filter{ };
+
+    for (int i{ 2 }; i < argc; ++i)
+    {
+        std::string_view const arg{ argv[i] };
+
+        if      (arg == "--format=text") Benchmarks::set_output_format(Benchmarks::OutputFormat::TEXT);
+        else if (arg == "--format=csv")  Benchmarks::set_output_format(Benchmarks::OutputFormat::CSV);
+        else if (arg == "--format=json") Benchmarks::set_output_format(Benchmarks::OutputFormat::JSON);
+        else if (arg.starts_with("--filter=")) filter = arg.substr(std::string_view{ "--filter=" }.size());
+        else
+        {
+            std::cerr << "Unknown option: " << arg << "\n";
+            std::cerr << "Usage: " << argv[0] << " --benchmark [--format=text|csv|json] [--filter=<part of benchmark name>]\n";
+            std::cerr << "Benchmarks:";
+            for (auto const& [name, benchmark] : BENCHMARKS) std::cerr << " " << name;
+            std::cerr << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (auto const& [name, benchmark] : BENCHMARKS)
+    {
+        if (name.find(filter) != std::string_view::npos) benchmark(std::cout);
+    }
+
+    Benchmarks::print_report(std::cout);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::string_view{ argv[1] } == "--benchmark")
+    {
+        return run_benchmarks(argc, argv);
+    }
+
     std::size_t n_tests{ 0U };
     std::size_t n_failed{ 0U };
 
@@ -15,9 +88,31 @@ int main()
     ++n_tests, n_failed += !UnitTests::is_pass_parameter_constructor_test(std::clog, std::cerr);
     ++n_tests, n_failed += !UnitTests::is_pass_swapping_test(std::clog, std::cerr);
     ++n_tests, n_failed += !UnitTests::is_pass_iterator_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_linear_iteration_test(std::clog, std::cerr);
     ++n_tests, n_failed += !UnitTests::is_pass_views_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_strided_views_test(std::clog, std::cerr);
     ++n_tests, n_failed += !UnitTests::is_pass_math_operations_test(std::clog, std::cerr);
     ++n_tests, n_failed += !UnitTests::is_pass_transformations_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_dynamic_matrix_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_lu_decomposition_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_bareiss_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_closed_form_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_affine_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_batch_transform_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_structured_transform_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_matrix_chain_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_submatrix_views_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_matrix_batch_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_matrix_ref_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_constexpr_math_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_fixed_point_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_vec2_batch_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_fast_math_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_rectangle_batch_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_clipping_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_swept_collision_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_separating_axis_test(std::clog, std::cerr);
+    ++n_tests, n_failed += !UnitTests::is_pass_bounding_volumes_test(std::clog, std::cerr);
 
     std::clog << UnitTests::SEPARATOR << "\n";
     std::clog << "TESTS COMPLETED\n";